@@ -47,9 +47,34 @@ namespace
         HOME_PACKAGE_PATH,
         HOME_LAUNCH_COMMAND_ID_DEFAULT,
         HOME_LAUNCH_COMMAND_ID_STARTUP,
+        USER_SERVICE_EVENT_SOURCE,
+        PLATFORM_SERVICE_EVENT_SOURCE,
+        SERVICE_REACTOR_THREADS,
+        USER_APP_SEND_HIGH_WATERMARK,
+        USER_SERVICE_SEND_HIGH_WATERMARK,
+        PLATFORM_SERVICE_SEND_HIGH_WATERMARK,
+        USER_APP_SEND_LOW_WATERMARK,
+        USER_SERVICE_SEND_LOW_WATERMARK,
+        PLATFORM_SERVICE_SEND_LOW_WATERMARK,
+        USER_APP_PIPE_SIZE,
+        USER_SERVICE_PIPE_SIZE,
+        PLATFORM_SERVICE_PIPE_SIZE,
+        USER_APP_READ_BATCH_SIZE,
+        USER_SERVICE_READ_BATCH_SIZE,
+        PLATFORM_SERVICE_READ_BATCH_SIZE,
+        USER_APP_WRITE_BATCH_SIZE,
+        USER_SERVICE_WRITE_BATCH_SIZE,
+        PLATFORM_SERVICE_WRITE_BATCH_SIZE,
+        USER_APP_WIRE_VERSION,
+        USER_SERVICE_WIRE_VERSION,
+        PLATFORM_SERVICE_WIRE_VERSION,
+        
+        // Event Source
+        EVENT_SOURCE_PIPE,
+        EVENT_SOURCE_SHARED_MEMORY,
 
         // Bounds
-        IDENTIFIER_MAX = HOME_LAUNCH_COMMAND_ID_STARTUP,
+        IDENTIFIER_MAX = EVENT_SOURCE_SHARED_MEMORY,
 
         IDENTIFIER_COUNT = IDENTIFIER_MAX + 1
     };
@@ -72,8 +97,70 @@ namespace
         "PlatformServiceEventLimit",
         "HomePackagePath",
         "HomePackageDefaultLaunchCommandID",
-        "HomePackageStartupLaunchCommandID"
+        "HomePackageStartupLaunchCommandID",
+        "UserServiceEventSource",
+        "PlatformServiceEventSource",
+        "ServiceReactorThreads",
+        "UserAppSendHighWatermark",
+        "UserServiceSendHighWatermark",
+        "PlatformServiceSendHighWatermark",
+        "UserAppSendLowWatermark",
+        "UserServiceSendLowWatermark",
+        "PlatformServiceSendLowWatermark",
+        "UserAppPipeSize",
+        "UserServicePipeSize",
+        "PlatformServicePipeSize",
+        "UserAppReadBatchSize",
+        "UserServiceReadBatchSize",
+        "PlatformServiceReadBatchSize",
+        "UserAppWriteBatchSize",
+        "UserServiceWriteBatchSize",
+        "PlatformServiceWriteBatchSize",
+        "UserAppWireVersion",
+        "UserServiceWireVersion",
+        "PlatformServiceWireVersion",
+        
+        // Event Source
+        "Pipe",
+        "SharedMemory"
     };
+    
+#ifdef __MRH_MRHCKM_SUPPORTED__
+    constexpr TransmissionSource::SourceType e_DefaultEventSource = TransmissionSource::MRHCKM;
+#else
+    constexpr TransmissionSource::SourceType e_DefaultEventSource = TransmissionSource::PIPE;
+#endif
+    
+    std::string GetOptionalValue(MRH_ValueBlock& c_Block, const char* p_Key) noexcept
+    {
+        // Missing optional values keep their defaults
+        try
+        {
+            return c_Block.GetValue(p_Key);
+        }
+        catch (...)
+        {
+            return "";
+        }
+    }
+    
+    TransmissionSource::SourceType ParseEventSource(std::string const& s_Value, TransmissionSource::SourceType e_Default)
+    {
+        if (s_Value.size() == 0)
+        {
+            return e_Default;
+        }
+        else if (s_Value.compare(p_Identifier[EVENT_SOURCE_PIPE]) == 0)
+        {
+            return TransmissionSource::PIPE;
+        }
+        else if (s_Value.compare(p_Identifier[EVENT_SOURCE_SHARED_MEMORY]) == 0)
+        {
+            return TransmissionSource::SHARED_MEMORY;
+        }
+        
+        throw ConfigurationException("Unknown event source: " + s_Value, MRH_CORE_CONFIGURATION_FILE_PATH);
+    }
 }
 
 
@@ -85,6 +172,7 @@ CoreConfiguration::CoreConfiguration() noexcept : s_AppParentBinaryPath(""),
                                                   s_AppServiceParentBinaryPath(""),
                                                   u32_ForceStopTimerS(3),
                                                   u32_WaitSleepTimerMS(100),
+                                                  u32_ServiceReactorThreads(0),
                                                   s_HomePackagePath(""),
                                                   i_HomePackageDefaultLaunchCommandID(0),
                                                   i_HomePackageStartupLaunchCommandID(0)
@@ -93,6 +181,13 @@ CoreConfiguration::CoreConfiguration() noexcept : s_AppParentBinaryPath(""),
     {
         p_RecieveTimeoutMS[i] = 100;
         p_EventLimit[i] = 10;
+        p_EventSource[i] = e_DefaultEventSource;
+        p_SendHighWatermark[i] = 0;
+        p_SendLowWatermark[i] = 0;
+        p_PipeSize[i] = 0;
+        p_ReadBatchSize[i] = 0;
+        p_WriteBatchSize[i] = 0;
+        p_WireVersion[i] = 1;
     }
 }
 
@@ -153,6 +248,48 @@ void CoreConfiguration::Load()
                 p_EventLimit[PLATFORM_SERVICE] = 1;
             }
             
+            p_EventSource[USER_SERVICE] = ParseEventSource(GetOptionalValue(Block, p_Identifier[USER_SERVICE_EVENT_SOURCE]), e_DefaultEventSource);
+            p_EventSource[PLATFORM_SERVICE] = ParseEventSource(GetOptionalValue(Block, p_Identifier[PLATFORM_SERVICE_EVENT_SOURCE]), e_DefaultEventSource);
+            
+            // Service update
+            std::string s_ReactorThreads = GetOptionalValue(Block, p_Identifier[SERVICE_REACTOR_THREADS]);
+            u32_ServiceReactorThreads = (s_ReactorThreads.size() > 0 ? static_cast<MRH_Uint32>(std::stoull(s_ReactorThreads)) : 0);
+            
+            // Send backpressure, the low watermark defaults to half the high watermark
+            for (size_t i = 0; i < QUEUE_COUNT; ++i)
+            {
+                std::string s_High = GetOptionalValue(Block, p_Identifier[USER_APP_SEND_HIGH_WATERMARK + i]);
+                std::string s_Low = GetOptionalValue(Block, p_Identifier[USER_APP_SEND_LOW_WATERMARK + i]);
+                
+                p_SendHighWatermark[i] = (s_High.size() > 0 ? static_cast<MRH_Uint32>(std::stoull(s_High)) : 0);
+                p_SendLowWatermark[i] = (s_Low.size() > 0 ? static_cast<MRH_Uint32>(std::stoull(s_Low)) : p_SendHighWatermark[i] / 2);
+                
+                if (p_SendLowWatermark[i] >= p_SendHighWatermark[i])
+                {
+                    p_SendLowWatermark[i] = (p_SendHighWatermark[i] > 0 ? p_SendHighWatermark[i] - 1 : 0);
+                }
+            }
+            
+            // Transport, 0 keeps the source defaults
+            for (size_t i = 0; i < QUEUE_COUNT; ++i)
+            {
+                std::string s_PipeSize = GetOptionalValue(Block, p_Identifier[USER_APP_PIPE_SIZE + i]);
+                std::string s_ReadBatchSize = GetOptionalValue(Block, p_Identifier[USER_APP_READ_BATCH_SIZE + i]);
+                std::string s_WriteBatchSize = GetOptionalValue(Block, p_Identifier[USER_APP_WRITE_BATCH_SIZE + i]);
+                
+                p_PipeSize[i] = (s_PipeSize.size() > 0 ? static_cast<size_t>(std::stoull(s_PipeSize)) : 0);
+                p_ReadBatchSize[i] = (s_ReadBatchSize.size() > 0 ? static_cast<size_t>(std::stoull(s_ReadBatchSize)) : 0);
+                p_WriteBatchSize[i] = (s_WriteBatchSize.size() > 0 ? static_cast<MRH_Uint32>(std::stoull(s_WriteBatchSize)) : 0);
+            }
+            
+            // Wire format, batches (v2) have to be supported by the child
+            for (size_t i = 0; i < QUEUE_COUNT; ++i)
+            {
+                std::string s_WireVersion = GetOptionalValue(Block, p_Identifier[USER_APP_WIRE_VERSION + i]);
+                
+                p_WireVersion[i] = (s_WireVersion.size() > 0 && std::stoull(s_WireVersion) > 1 ? 2 : 1);
+            }
+            
             // Home (default) package
             s_HomePackagePath = Block.GetValue(p_Identifier[HOME_PACKAGE_PATH]);
             
@@ -167,6 +304,10 @@ void CoreConfiguration::Load()
             break;
         }
     }
+    catch (ConfigurationException& e)
+    {
+        throw;
+    }
     catch (std::exception& e)
     {
         throw ConfigurationException("Could not read core configuration: " + std::string(e.what()), MRH_CORE_CONFIGURATION_FILE_PATH);
@@ -217,6 +358,81 @@ MRH_Uint32 CoreConfiguration::GetEventLimit(Queue e_Queue) const
     return p_EventLimit[e_Queue];
 }
 
+TransmissionSource::SourceType CoreConfiguration::GetEventSource(Queue e_Queue) const
+{
+    if (e_Queue > QUEUE_MAX)
+    {
+        throw ConfigurationException("Invalid queue: " + std::to_string(e_Queue), MRH_CORE_CONFIGURATION_FILE_PATH);
+    }
+    
+    return p_EventSource[e_Queue];
+}
+
+MRH_Uint32 CoreConfiguration::GetSendHighWatermark(Queue e_Queue) const
+{
+    if (e_Queue > QUEUE_MAX)
+    {
+        throw ConfigurationException("Invalid queue: " + std::to_string(e_Queue), MRH_CORE_CONFIGURATION_FILE_PATH);
+    }
+    
+    return p_SendHighWatermark[e_Queue];
+}
+
+MRH_Uint32 CoreConfiguration::GetSendLowWatermark(Queue e_Queue) const
+{
+    if (e_Queue > QUEUE_MAX)
+    {
+        throw ConfigurationException("Invalid queue: " + std::to_string(e_Queue), MRH_CORE_CONFIGURATION_FILE_PATH);
+    }
+    
+    return p_SendLowWatermark[e_Queue];
+}
+
+size_t CoreConfiguration::GetPipeSize(Queue e_Queue) const
+{
+    if (e_Queue > QUEUE_MAX)
+    {
+        throw ConfigurationException("Invalid queue: " + std::to_string(e_Queue), MRH_CORE_CONFIGURATION_FILE_PATH);
+    }
+    
+    return p_PipeSize[e_Queue];
+}
+
+size_t CoreConfiguration::GetReadBatchSize(Queue e_Queue) const
+{
+    if (e_Queue > QUEUE_MAX)
+    {
+        throw ConfigurationException("Invalid queue: " + std::to_string(e_Queue), MRH_CORE_CONFIGURATION_FILE_PATH);
+    }
+    
+    return p_ReadBatchSize[e_Queue];
+}
+
+MRH_Uint32 CoreConfiguration::GetWriteBatchSize(Queue e_Queue) const
+{
+    if (e_Queue > QUEUE_MAX)
+    {
+        throw ConfigurationException("Invalid queue: " + std::to_string(e_Queue), MRH_CORE_CONFIGURATION_FILE_PATH);
+    }
+    
+    return p_WriteBatchSize[e_Queue];
+}
+
+MRH_Uint32 CoreConfiguration::GetWireVersion(Queue e_Queue) const
+{
+    if (e_Queue > QUEUE_MAX)
+    {
+        throw ConfigurationException("Invalid queue: " + std::to_string(e_Queue), MRH_CORE_CONFIGURATION_FILE_PATH);
+    }
+    
+    return p_WireVersion[e_Queue];
+}
+
+MRH_Uint32 CoreConfiguration::GetServiceReactorThreads() const noexcept
+{
+    return u32_ServiceReactorThreads;
+}
+
 std::string CoreConfiguration::GetHomePackagePath() const noexcept
 {
     return s_HomePackagePath;
@@ -25,6 +25,7 @@
 
 // Project
 #include "./ConfigurationException.h"
+#include "../Event/Source/TransmissionSource.h"
 
 
 class CoreConfiguration
@@ -136,6 +137,85 @@ public:
      */
     
     MRH_Uint32 GetEventLimit(Queue e_Queue) const;
+    
+    /**
+     *  Get the event transmission source.
+     *
+     *  \param e_Queue The queue this source is for.
+     *
+     *  \return The event transmission source type.
+     */
+    
+    TransmissionSource::SourceType GetEventSource(Queue e_Queue) const;
+    
+    /**
+     *  Get the send backlog at which producers are throttled.
+     *
+     *  \param e_Queue The queue this watermark is for.
+     *
+     *  \return The high watermark in events, 0 if disabled.
+     */
+    
+    MRH_Uint32 GetSendHighWatermark(Queue e_Queue) const;
+    
+    /**
+     *  Get the send backlog at which throttled producers are released.
+     *
+     *  \param e_Queue The queue this watermark is for.
+     *
+     *  \return The low watermark in events.
+     */
+    
+    MRH_Uint32 GetSendLowWatermark(Queue e_Queue) const;
+    
+    /**
+     *  Get the requested event pipe capacity.
+     *
+     *  \param e_Queue The queue this capacity is for.
+     *
+     *  \return The pipe capacity in bytes, 0 for the kernel default.
+     */
+    
+    size_t GetPipeSize(Queue e_Queue) const;
+    
+    /**
+     *  Get the event recieve buffer size.
+     *
+     *  \param e_Queue The queue this buffer is for.
+     *
+     *  \return The buffer size in bytes, 0 for the default.
+     */
+    
+    size_t GetReadBatchSize(Queue e_Queue) const;
+    
+    /**
+     *  Get the max amount of events written in a single batch.
+     *
+     *  \param e_Queue The queue this batch size is for.
+     *
+     *  \return The batch size in events, 0 for the event limit.
+     */
+    
+    MRH_Uint32 GetWriteBatchSize(Queue e_Queue) const;
+    
+    /**
+     *  Get the highest event wire format version offered to processes.
+     *
+     *  \param e_Queue The queue this version is for.
+     *
+     *  \return The wire format version.
+     */
+    
+    MRH_Uint32 GetWireVersion(Queue e_Queue) const;
+    
+    /**
+     *  Get the amount of reactor threads updating services. This function is
+     *  thread safe.
+     *
+     *  \return The reactor thread count, 0 if each service uses its own thread.
+     */
+    
+    MRH_Uint32 GetServiceReactorThreads() const noexcept;
 
     /**
      *  Get the default package path.
@@ -194,6 +274,18 @@ private:
     
     // Events
     MRH_Uint32 p_EventLimit[QUEUE_COUNT];
+    TransmissionSource::SourceType p_EventSource[QUEUE_COUNT];
+    MRH_Uint32 p_SendHighWatermark[QUEUE_COUNT];
+    MRH_Uint32 p_SendLowWatermark[QUEUE_COUNT];
+    
+    // Transport
+    size_t p_PipeSize[QUEUE_COUNT];
+    size_t p_ReadBatchSize[QUEUE_COUNT];
+    MRH_Uint32 p_WriteBatchSize[QUEUE_COUNT];
+    MRH_Uint32 p_WireVersion[QUEUE_COUNT];
+    
+    // Service update
+    MRH_Uint32 u32_ServiceReactorThreads;
 
     // App
     std::string s_HomePackagePath;
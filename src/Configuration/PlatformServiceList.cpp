@@ -37,9 +37,13 @@ namespace
         KEY_ROUTE_ID = 2,
         KEY_DISABLED = 3,
         KEY_IS_ESSENTIAL = 4,
+        KEY_PIPE_SIZE = 5,
+        KEY_READ_BATCH_SIZE = 6,
+        KEY_WRITE_BATCH_SIZE = 7,
+        KEY_WIRE_VERSION = 8,
         
         // Bounds
-        IDENTIFIER_MAX = KEY_IS_ESSENTIAL,
+        IDENTIFIER_MAX = KEY_WIRE_VERSION,
         
         IDENTIFIER_COUNT = IDENTIFIER_MAX + 1
     };
@@ -53,8 +57,29 @@ namespace
         "BinaryPath",
         "RouteID",
         "Disabled",
-        "IsEssential"
+        "IsEssential",
+        "PipeSize",
+        "ReadBatchSize",
+        "WriteBatchSize",
+        "WireVersion"
     };
+    
+    size_t GetOptionalSize(MRH_ValueBlock& c_Block, const char* p_Key)
+    {
+        // Missing transport values use the pool settings
+        std::string s_Value;
+        
+        try
+        {
+            s_Value = c_Block.GetValue(p_Key);
+        }
+        catch (...)
+        {
+            return 0;
+        }
+        
+        return (s_Value.size() > 0 ? static_cast<size_t>(std::stoull(s_Value)) : 0);
+    }
 }
 
 
@@ -86,7 +111,11 @@ PlatformServiceList::PlatformServiceList()
                 v_Service.push_back(Service(Block.GetValue(p_Identifier[KEY_BINARY_PATH]),
                                             static_cast<MRH_Uint32>(std::stoull(Block.GetValue(p_Identifier[KEY_ROUTE_ID]))),
                                             Block.GetValue(p_Identifier[KEY_DISABLED]).compare("1") == 0 ? true : false,
-                                            Block.GetValue(p_Identifier[KEY_IS_ESSENTIAL]).compare("1") == 0 ? true : false));
+                                            Block.GetValue(p_Identifier[KEY_IS_ESSENTIAL]).compare("1") == 0 ? true : false,
+                                            GetOptionalSize(Block, p_Identifier[KEY_PIPE_SIZE]),
+                                            GetOptionalSize(Block, p_Identifier[KEY_READ_BATCH_SIZE]),
+                                            static_cast<MRH_Uint32>(GetOptionalSize(Block, p_Identifier[KEY_WRITE_BATCH_SIZE])),
+                                            static_cast<MRH_Uint32>(GetOptionalSize(Block, p_Identifier[KEY_WIRE_VERSION]))));
                 
                 c_Logger.Log(Logger::INFO, "Read platform service " +
                                            std::to_string(us_Service) +
@@ -130,12 +159,20 @@ PlatformServiceList::~PlatformServiceList() noexcept
 PlatformServiceList::Service::Service(std::string const& s_BinaryPath,
                                       MRH_Uint32 u32_RouteID,
                                       bool b_Disabled,
-                                      bool b_Essential) noexcept
+                                      bool b_Essential,
+                                      size_t us_PipeSize,
+                                      size_t us_ReadBatchSize,
+                                      MRH_Uint32 u32_WriteBatchSize,
+                                      MRH_Uint32 u32_WireVersion) noexcept
 {
     this->s_BinaryPath = s_BinaryPath;
     this->u32_RouteID = u32_RouteID;
     this->b_Disabled = b_Disabled;
     this->b_Essential = b_Essential;
+    this->us_PipeSize = us_PipeSize;
+    this->us_ReadBatchSize = us_ReadBatchSize;
+    this->u32_WriteBatchSize = u32_WriteBatchSize;
+    this->u32_WireVersion = u32_WireVersion;
 }
 
 PlatformServiceList::Service::Service(Service const& c_Service) noexcept
@@ -144,6 +181,10 @@ PlatformServiceList::Service::Service(Service const& c_Service) noexcept
     u32_RouteID = c_Service.u32_RouteID;
     b_Disabled = c_Service.b_Disabled;
     b_Essential = c_Service.b_Essential;
+    us_PipeSize = c_Service.us_PipeSize;
+    us_ReadBatchSize = c_Service.us_ReadBatchSize;
+    u32_WriteBatchSize = c_Service.u32_WriteBatchSize;
+    u32_WireVersion = c_Service.u32_WireVersion;
 }
 
 PlatformServiceList::Service::~Service() noexcept
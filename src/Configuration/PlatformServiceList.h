@@ -68,6 +68,12 @@ public:
         bool b_Disabled;
         bool b_Essential;
         
+        // Transport, 0 uses the pool setting
+        size_t us_PipeSize;
+        size_t us_ReadBatchSize;
+        MRH_Uint32 u32_WriteBatchSize;
+        MRH_Uint32 u32_WireVersion;
+    
     private:
         
         //*************************************************************************************
@@ -81,12 +87,20 @@ public:
          *  \param u32_RouteID The service event route id.
          *  \param b_Disabled Defines if the service is disabled or not.
          *  \param b_Essential Defines if the service is essential to exist or not.
+         *  \param us_PipeSize The event pipe capacity in bytes.
+         *  \param us_ReadBatchSize The event recieve buffer size in bytes.
+         *  \param u32_WriteBatchSize The max amount of events written in a single batch.
+         *  \param u32_WireVersion The highest event wire format version offered.
          */
 
         Service(std::string const& s_BinaryPath,
                 MRH_Uint32 u32_RouteID,
                 bool b_Disabled,
-                bool b_Essential) noexcept;
+                bool b_Essential,
+                size_t us_PipeSize,
+                size_t us_ReadBatchSize,
+                MRH_Uint32 u32_WriteBatchSize,
+                MRH_Uint32 u32_WireVersion) noexcept;
 
         //*************************************************************************************
         // Data
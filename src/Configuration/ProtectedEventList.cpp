@@ -36,7 +36,7 @@ namespace
 // Constructor / Destructor
 //*************************************************************************************
 
-ProtectedEventList::ProtectedEventList() noexcept
+ProtectedEventList::ProtectedEventList() noexcept : u32_Revision(0)
 {}
 
 ProtectedEventList::~ProtectedEventList() noexcept
@@ -65,9 +65,8 @@ void ProtectedEventList::Update()
         c_Logger.Log(Logger::INFO, "Reading " MRH_PROTECTED_EVENT_LIST_FILE_PATH " protected event config...",
                      "ProtectedEventList.cpp", __LINE__);
         
-        std::lock_guard<std::mutex> c_Guard(c_Mutex);
-        
         MRH_BlockFile c_File(MRH_PROTECTED_EVENT_LIST_FILE_PATH);
+        std::vector<MRH_Uint32> v_Read;
         
         for (auto& Block : c_File.l_Block)
         {
@@ -80,7 +79,7 @@ void ProtectedEventList::Update()
             
             for (auto& Pair : l_Value)
             {
-                v_Protected.emplace_back(static_cast<MRH_Uint32>(std::stoull(Pair.second)));
+                v_Read.emplace_back(static_cast<MRH_Uint32>(std::stoull(Pair.second)));
                 
                 c_Logger.Log(Logger::INFO, "Event " +
                                            Pair.first +
@@ -91,6 +90,12 @@ void ProtectedEventList::Update()
             }
         }
         
+        // Replace the old list, users rebuild on revision change
+        c_Mutex.lock();
+        v_Protected.swap(v_Read);
+        u32_Revision += 1;
+        c_Mutex.unlock();
+        
         c_Logger.Log(Logger::INFO, "Read " MRH_PROTECTED_EVENT_LIST_FILE_PATH " protected event config.",
                      "ProtectedEventList.cpp", __LINE__);
     }
@@ -150,3 +155,23 @@ bool ProtectedEventList::GetEventProtected(MRH_Uint32 u32_Type) noexcept
     
     return false;
 }
+
+MRH_Uint32 ProtectedEventList::GetEvents(std::vector<MRH_Uint32>& v_Event)
+{
+    try
+    {
+        std::lock_guard<std::mutex> c_Guard(c_Mutex);
+        
+        v_Event = v_Protected;
+        return u32_Revision;
+    }
+    catch (std::exception& e)
+    {
+        throw ConfigurationException(e.what(), MRH_PROTECTED_EVENT_LIST_FILE_PATH);
+    }
+}
+
+MRH_Uint32 ProtectedEventList::GetRevision() const noexcept
+{
+    return u32_Revision;
+}
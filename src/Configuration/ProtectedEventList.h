@@ -18,6 +18,7 @@
 #define ProtectedEventList_h
 
 // C / C++
+#include <atomic>
 #include <mutex>
 #include <vector>
 
@@ -61,7 +62,8 @@ public:
     //*************************************************************************************
 
     /**
-     *  Update the configuration. This function is thread safe.
+     *  Update the configuration. The previous list is replaced and the
+     *  revision changed. This function is thread safe.
      */
     
     void Update();
@@ -99,6 +101,25 @@ public:
     
     bool GetEventProtected(MRH_Uint32 u32_Type) noexcept;
     
+    /**
+     *  Get all protected events. This function is thread safe.
+     *
+     *  \param v_Event The vector to replace with the protected events.
+     *
+     *  \return The list revision of the returned events.
+     */
+    
+    MRH_Uint32 GetEvents(std::vector<MRH_Uint32>& v_Event);
+    
+    /**
+     *  Get the current list revision. The revision changes with each update.
+     *  This function is thread safe.
+     *
+     *  \return The current list revision.
+     */
+    
+    MRH_Uint32 GetRevision() const noexcept;
+
 private:
     
     //*************************************************************************************
@@ -123,6 +144,7 @@ private:
 
     std::mutex c_Mutex;
     std::vector<MRH_Uint32> v_Protected;
+    std::atomic<MRH_Uint32> u32_Revision;
     
 protected:
 
@@ -22,6 +22,7 @@
 
 // Project
 #include "./Event.h"
+#include "./EventAllocator.h"
 
 
 //*************************************************************************************
@@ -35,6 +36,12 @@ Event::Event(MRH_Uint32 u32_GroupID,
                                         u32_Type(u32_Type),
                                         u32_DataSize(u32_DataSize)
 {
+#if MRH_CORE_EVENT_TRACING > 0
+    // Stamped on ingress
+    u32_TraceUS = 0;
+    u32_TraceSource = 0;
+    
+#endif
     // Check and create data buffer
     if (this->u32_DataSize > 0)
     {
@@ -43,13 +50,21 @@ Event::Event(MRH_Uint32 u32_GroupID,
             throw EventException("Event data size > 0, but event data is NULL!");
         }
         
+#if MRH_CORE_EVENT_INLINE_DATA_SIZE > 0
+        // Small data, no allocation needed
+        if (u32_DataSize <= MRH_CORE_EVENT_INLINE_DATA_SIZE)
+        {
+            std::memcpy(p_InlineData, p_Data, u32_DataSize);
+            return;
+        }
+#endif
+        
         try
         {
-            // < C++17 = Add special delete
-            if ((this->p_Data = std::shared_ptr<MRH_Uint8>(new MRH_Uint8[u32_DataSize], std::default_delete<MRH_Uint8[]>())) == NULL)
-            {
-                throw EventException("Failed to allocate event data!");
-            }
+            // Data and control block both use the event allocator
+            this->p_Data = std::shared_ptr<MRH_Uint8>(static_cast<MRH_Uint8*>(EventAllocator::Singleton().Allocate(u32_DataSize)),
+                                                      EventAllocator::Deleter(u32_DataSize),
+                                                      EventAllocator::Allocator<MRH_Uint8>());
         }
         catch (std::exception& e)
         {
@@ -73,6 +88,11 @@ Event::Event(MRH_Uint32 u32_GroupID,
     // Event has no data
     u32_DataSize = 0;
     p_Data = NULL;
+    
+#if MRH_CORE_EVENT_TRACING > 0
+    u32_TraceUS = 0;
+    u32_TraceSource = 0;
+#endif
 }
 
 Event::~Event() noexcept
@@ -94,6 +114,13 @@ MRH_Uint32 Event::GetType() const noexcept
 
 const MRH_Uint8* Event::GetData() const noexcept
 {
+#if MRH_CORE_EVENT_INLINE_DATA_SIZE > 0
+    if (u32_DataSize > 0 && u32_DataSize <= MRH_CORE_EVENT_INLINE_DATA_SIZE)
+    {
+        return p_InlineData;
+    }
+#endif
+    
     return p_Data.get();
 }
 
@@ -26,10 +26,18 @@
 // Project
 #include "./EventException.h"
 
+// Pre-defined
+#ifndef MRH_CORE_EVENT_INLINE_DATA_SIZE
+    #define MRH_CORE_EVENT_INLINE_DATA_SIZE 48
+#endif
+#ifndef MRH_CORE_EVENT_TRACING
+    #define MRH_CORE_EVENT_TRACING 0
+#endif
 
 class Event
 {
     friend class EventQueue;
+    friend class EventTrace;
     
 public:
     
@@ -83,7 +91,7 @@ public:
     {
         if (u32_Start < u32_DataSize && u32_Start + sizeof(T) < u32_DataSize)
         {
-            return static_cast<T>(*((T*)(&(p_Data.get()[u32_Start]))));
+            return static_cast<T>(*((T*)(&(GetData()[u32_Start]))));
         }
         
         throw EventException("Invalid event data value cast!");
@@ -101,7 +109,7 @@ public:
     {
         if (u32_Start < u32_DataSize)
         {
-            return (T)(&(p_Data.get()[u32_Start]));
+            return (T)(&(GetData()[u32_Start]));
         }
         
         throw EventException("Invalid event data pointer cast!");
@@ -151,8 +159,20 @@ private:
 
     MRH_Uint32 u32_GroupID;
     MRH_Uint32 u32_Type;
-    std::shared_ptr<MRH_Uint8> p_Data;
     MRH_Uint32 u32_DataSize;
+    
+#if MRH_CORE_EVENT_TRACING > 0
+    // Ingress time and source endpoint, 0 if not traced
+    MRH_Uint32 u32_TraceUS;
+    MRH_Uint32 u32_TraceSource;
+#endif
+    
+    // Data up to the inline size is stored in the event itself,
+    // larger data is shared between copies
+    std::shared_ptr<MRH_Uint8> p_Data;
+#if MRH_CORE_EVENT_INLINE_DATA_SIZE > 0
+    alignas(8) MRH_Uint8 p_InlineData[MRH_CORE_EVENT_INLINE_DATA_SIZE];
+#endif
 
 protected:
 
@@ -0,0 +1,352 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <new>
+
+// External
+
+// Project
+#include "./EventAllocator.h"
+#include "../Logger/Logger.h"
+
+// Pre-defined
+namespace
+{
+    // Smallest pooled block size, 1 << 6 = 64 bytes
+    constexpr size_t us_MinSizeShift = 6;
+    
+    // Minimum slab size, larger blocks use a single block slab
+    constexpr size_t us_SlabSize = 65536;
+    
+    // Blocks kept per size class and thread, released in batches
+    constexpr size_t us_CacheLimit = 64;
+    constexpr size_t us_CacheBatch = 32;
+    
+    // @NOTE: Trivially destructible, stays usable while other thread
+    //        local objects are destroyed
+    struct ThreadCache
+    {
+        void* p_Free[EventAllocator::SIZE_CLASS_COUNT];
+        size_t p_Count[EventAllocator::SIZE_CLASS_COUNT];
+        bool b_Closed;
+    };
+    
+    thread_local ThreadCache c_ThreadCache = {};
+    
+    // Returns cached blocks on thread exit
+    struct ThreadCacheGuard
+    {
+        ~ThreadCacheGuard() noexcept
+        {
+            EventAllocator::Singleton().FlushThreadCache();
+            c_ThreadCache.b_Closed = true;
+        }
+    };
+    
+    thread_local ThreadCacheGuard c_ThreadCacheGuard;
+    
+    inline void*& GetNext(void* p_Block) noexcept
+    {
+        return *static_cast<void**>(p_Block);
+    }
+    
+    inline size_t GetBlockSize(size_t us_Class) noexcept
+    {
+        return static_cast<size_t>(1) << (us_MinSizeShift + us_Class);
+    }
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+EventAllocator::EventAllocator() noexcept : us_SlabBytes(0),
+                                            us_LiveBytes(0),
+                                            us_PeakBytes(0),
+                                            c_LastStatistics(std::chrono::steady_clock::now())
+{
+    for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+    {
+        p_Pool[i].p_Free = NULL;
+        p_Pool[i].u64_Allocations = 0;
+        p_Pool[i].us_Live = 0;
+        p_Pool[i].u64_LastAllocations = 0;
+    }
+}
+
+EventAllocator::~EventAllocator() noexcept
+{
+    for (auto& Slab : v_Slab)
+    {
+        delete[] Slab;
+    }
+}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+EventAllocator& EventAllocator::Singleton() noexcept
+{
+    // @NOTE: Never destroyed, events in static storage and thread exits
+    //        may still free memory during shutdown
+    static EventAllocator* p_EventAllocator = new EventAllocator();
+    return *p_EventAllocator;
+}
+
+//*************************************************************************************
+// Allocate
+//*************************************************************************************
+
+void* EventAllocator::Allocate(size_t us_Size)
+{
+    SizeClass e_Class = GetSizeClass(us_Size);
+    void* p_Memory;
+    
+    if (e_Class == SIZE_LARGE)
+    {
+        p_Memory = ::operator new(us_Size);
+    }
+    else
+    {
+        ThreadCache& c_Cache = c_ThreadCache;
+        
+        if (c_Cache.p_Free[e_Class] == NULL)
+        {
+            Refill(e_Class);
+        }
+        
+        p_Memory = c_Cache.p_Free[e_Class];
+        c_Cache.p_Free[e_Class] = GetNext(p_Memory);
+        --(c_Cache.p_Count[e_Class]);
+        
+        us_Size = GetBlockSize(e_Class);
+    }
+    
+    // Statistics
+    p_Pool[e_Class].u64_Allocations.fetch_add(1, std::memory_order_relaxed);
+    p_Pool[e_Class].us_Live.fetch_add(us_Size, std::memory_order_relaxed);
+    
+    size_t us_Live = us_LiveBytes.fetch_add(us_Size, std::memory_order_relaxed) + us_Size;
+    size_t us_Peak = us_PeakBytes.load(std::memory_order_relaxed);
+    
+    while (us_Live > us_Peak && us_PeakBytes.compare_exchange_weak(us_Peak, us_Live, std::memory_order_relaxed) == false)
+    {}
+    
+    return p_Memory;
+}
+
+void EventAllocator::Free(void* p_Memory, size_t us_Size) noexcept
+{
+    if (p_Memory == NULL)
+    {
+        return;
+    }
+    
+    SizeClass e_Class = GetSizeClass(us_Size);
+    
+    if (e_Class == SIZE_LARGE)
+    {
+        ::operator delete(p_Memory);
+    }
+    else
+    {
+        us_Size = GetBlockSize(e_Class);
+        
+        // Blocks freed by a closed thread go directly to the pool
+        ThreadCache& c_Cache = c_ThreadCache;
+        
+        if (c_Cache.b_Closed == true)
+        {
+            std::lock_guard<std::mutex> c_Guard(p_Pool[e_Class].c_Mutex);
+            GetNext(p_Memory) = p_Pool[e_Class].p_Free;
+            p_Pool[e_Class].p_Free = p_Memory;
+        }
+        else
+        {
+            (void)&c_ThreadCacheGuard;
+            
+            GetNext(p_Memory) = c_Cache.p_Free[e_Class];
+            c_Cache.p_Free[e_Class] = p_Memory;
+            
+            if (++(c_Cache.p_Count[e_Class]) > us_CacheLimit)
+            {
+                Release(e_Class, us_CacheBatch);
+            }
+        }
+    }
+    
+    p_Pool[e_Class].us_Live.fetch_sub(us_Size, std::memory_order_relaxed);
+    us_LiveBytes.fetch_sub(us_Size, std::memory_order_relaxed);
+}
+
+void EventAllocator::FlushThreadCache() noexcept
+{
+    for (size_t i = 0; i < SIZE_LARGE; ++i)
+    {
+        Release(static_cast<SizeClass>(i), c_ThreadCache.p_Count[i]);
+    }
+}
+
+//*************************************************************************************
+// Pool
+//*************************************************************************************
+
+EventAllocator::SizeClass EventAllocator::GetSizeClass(size_t us_Size) noexcept
+{
+    size_t us_Class = 0;
+    
+    while (us_Class < SIZE_LARGE && GetBlockSize(us_Class) < us_Size)
+    {
+        ++us_Class;
+    }
+    
+    return static_cast<SizeClass>(us_Class);
+}
+
+void EventAllocator::Refill(SizeClass e_Class)
+{
+    ThreadCache& c_Cache = c_ThreadCache;
+    Pool& c_Pool = p_Pool[e_Class];
+    
+    // Register thread exit handling on first use
+    (void)&c_ThreadCacheGuard;
+    
+    std::lock_guard<std::mutex> c_Guard(c_Pool.c_Mutex);
+    
+    // Create a new slab if no free blocks remain
+    if (c_Pool.p_Free == NULL)
+    {
+        size_t us_BlockSize = GetBlockSize(e_Class);
+        size_t us_Size = (us_BlockSize < us_SlabSize ? us_SlabSize : us_BlockSize);
+        MRH_Uint8* p_Slab = new MRH_Uint8[us_Size];
+        
+        try
+        {
+            std::lock_guard<std::mutex> c_SlabGuard(c_SlabMutex);
+            v_Slab.emplace_back(p_Slab);
+            us_SlabBytes += us_Size;
+        }
+        catch (...)
+        {
+            delete[] p_Slab;
+            throw;
+        }
+        
+        for (size_t us_Pos = us_Size; us_Pos >= us_BlockSize; us_Pos -= us_BlockSize)
+        {
+            void* p_Block = p_Slab + (us_Pos - us_BlockSize);
+            GetNext(p_Block) = c_Pool.p_Free;
+            c_Pool.p_Free = p_Block;
+        }
+    }
+    
+    // Move a batch to the thread
+    for (size_t i = 0; i < us_CacheBatch && c_Pool.p_Free != NULL; ++i)
+    {
+        void* p_Block = c_Pool.p_Free;
+        c_Pool.p_Free = GetNext(p_Block);
+        
+        GetNext(p_Block) = c_Cache.p_Free[e_Class];
+        c_Cache.p_Free[e_Class] = p_Block;
+        ++(c_Cache.p_Count[e_Class]);
+    }
+}
+
+void EventAllocator::Release(SizeClass e_Class, size_t us_Count) noexcept
+{
+    ThreadCache& c_Cache = c_ThreadCache;
+    
+    if (us_Count == 0 || c_Cache.p_Free[e_Class] == NULL)
+    {
+        return;
+    }
+    
+    // Unlink batch from the thread first, keep the lock short
+    void* p_First = c_Cache.p_Free[e_Class];
+    void* p_Last = p_First;
+    size_t us_Released = 1;
+    
+    while (us_Released < us_Count && GetNext(p_Last) != NULL)
+    {
+        p_Last = GetNext(p_Last);
+        ++us_Released;
+    }
+    
+    c_Cache.p_Free[e_Class] = GetNext(p_Last);
+    c_Cache.p_Count[e_Class] -= us_Released;
+    
+    std::lock_guard<std::mutex> c_Guard(p_Pool[e_Class].c_Mutex);
+    GetNext(p_Last) = p_Pool[e_Class].p_Free;
+    p_Pool[e_Class].p_Free = p_First;
+}
+
+//*************************************************************************************
+// Statistics
+//*************************************************************************************
+
+void EventAllocator::LogStatistics() noexcept
+{
+    Logger& c_Logger = Logger::Singleton();
+    
+    std::lock_guard<std::mutex> c_Guard(c_StatisticsMutex);
+    
+    auto c_Now = std::chrono::steady_clock::now();
+    double f64_Seconds = std::chrono::duration<double>(c_Now - c_LastStatistics).count();
+    c_LastStatistics = c_Now;
+    
+    size_t us_SlabTotal;
+    
+    {
+        std::lock_guard<std::mutex> c_SlabGuard(c_SlabMutex);
+        us_SlabTotal = us_SlabBytes;
+    }
+    
+    c_Logger.Log(Logger::INFO, "Event allocator: " +
+                               std::to_string(us_LiveBytes.load(std::memory_order_relaxed)) +
+                               " bytes live, " +
+                               std::to_string(us_PeakBytes.load(std::memory_order_relaxed)) +
+                               " bytes peak, " +
+                               std::to_string(us_SlabTotal) +
+                               " bytes in slabs.",
+                 "EventAllocator.cpp", __LINE__);
+    
+    for (size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+    {
+        Pool& c_Pool = p_Pool[i];
+        MRH_Uint64 u64_Allocations = c_Pool.u64_Allocations.load(std::memory_order_relaxed);
+        MRH_Uint64 u64_New = u64_Allocations - c_Pool.u64_LastAllocations;
+        c_Pool.u64_LastAllocations = u64_Allocations;
+        
+        if (u64_Allocations == 0)
+        {
+            continue;
+        }
+        
+        c_Logger.Log(Logger::INFO, "Event allocator size class " +
+                                   (i == SIZE_LARGE ? std::string("large") : std::to_string(GetBlockSize(i))) +
+                                   ": " +
+                                   std::to_string(u64_Allocations) +
+                                   " allocations (" +
+                                   std::to_string(f64_Seconds > 0.0 ? static_cast<MRH_Uint64>(u64_New / f64_Seconds) : 0) +
+                                   "/s), " +
+                                   std::to_string(c_Pool.us_Live.load(std::memory_order_relaxed)) +
+                                   " bytes live.",
+                     "EventAllocator.cpp", __LINE__);
+    }
+}
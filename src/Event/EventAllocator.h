@@ -0,0 +1,283 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+#ifndef EventAllocator_h
+#define EventAllocator_h
+
+// C / C++
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+
+
+class EventAllocator
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef enum
+    {
+        SIZE_64 = 0,
+        SIZE_128 = 1,
+        SIZE_256 = 2,
+        SIZE_512 = 3,
+        SIZE_1K = 4,
+        SIZE_2K = 5,
+        SIZE_4K = 6,
+        SIZE_8K = 7,
+        SIZE_16K = 8,
+        SIZE_32K = 9,
+        SIZE_64K = 10,
+        SIZE_LARGE = 11, // Not pooled
+        
+        SIZE_CLASS_MAX = SIZE_LARGE,
+        
+        SIZE_CLASS_COUNT = SIZE_CLASS_MAX + 1
+        
+    }SizeClass;
+    
+    /**
+     *  Deleter for shared event data.
+     */
+    
+    class Deleter
+    {
+    public:
+        
+        /**
+         *  Default constructor.
+         *
+         *  \param us_Size The allocated size in bytes.
+         */
+        
+        Deleter(size_t us_Size) noexcept : us_Size(us_Size)
+        {}
+        
+        /**
+         *  Free the given memory.
+         *
+         *  \param p_Memory The memory to free.
+         */
+        
+        void operator()(MRH_Uint8* p_Memory) const noexcept
+        {
+            EventAllocator::Singleton().Free(p_Memory, us_Size);
+        }
+    
+    private:
+        
+        size_t us_Size;
+    };
+    
+    /**
+     *  Standard library allocator, used for shared pointer control blocks.
+     */
+    
+    template <typename T> class Allocator
+    {
+    public:
+        
+        typedef T value_type;
+        
+        Allocator() noexcept
+        {}
+        
+        template <typename U> Allocator(Allocator<U> const&) noexcept
+        {}
+        
+        T* allocate(size_t us_Count)
+        {
+            return static_cast<T*>(EventAllocator::Singleton().Allocate(us_Count * sizeof(T)));
+        }
+        
+        void deallocate(T* p_Memory, size_t us_Count) noexcept
+        {
+            EventAllocator::Singleton().Free(p_Memory, us_Count * sizeof(T));
+        }
+        
+        template <typename U> bool operator==(Allocator<U> const&) const noexcept
+        {
+            return true;
+        }
+        
+        template <typename U> bool operator!=(Allocator<U> const&) const noexcept
+        {
+            return false;
+        }
+    };
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_EventAllocator EventAllocator class source.
+     */
+    
+    EventAllocator(EventAllocator const& c_EventAllocator) = delete;
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance. This function is thread safe.
+     *
+     *  \return The class instance.
+     */
+    
+    static EventAllocator& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Allocate
+    //*************************************************************************************
+    
+    /**
+     *  Allocate event memory. This function is thread safe.
+     *
+     *  \param us_Size The size in bytes to allocate.
+     *
+     *  \return The allocated memory.
+     */
+    
+    void* Allocate(size_t us_Size);
+    
+    /**
+     *  Free event memory. The memory can be freed by any thread. This function
+     *  is thread safe.
+     *
+     *  \param p_Memory The memory to free.
+     *  \param us_Size The size in bytes given on allocation.
+     */
+    
+    void Free(void* p_Memory, size_t us_Size) noexcept;
+    
+    /**
+     *  Return all memory cached by the calling thread. This function is thread safe.
+     */
+    
+    void FlushThreadCache() noexcept;
+    
+    //*************************************************************************************
+    // Statistics
+    //*************************************************************************************
+    
+    /**
+     *  Log the allocator statistics. Rates are given since the last call.
+     *  This function is thread safe.
+     */
+    
+    void LogStatistics() noexcept;
+
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Pool
+    {
+        // Shared free blocks, linked by their first bytes
+        std::mutex c_Mutex;
+        void* p_Free;
+        
+        // Statistics
+        std::atomic<MRH_Uint64> u64_Allocations;
+        std::atomic<size_t> us_Live;
+        MRH_Uint64 u64_LastAllocations;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    EventAllocator() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~EventAllocator() noexcept;
+    
+    //*************************************************************************************
+    // Pool
+    //*************************************************************************************
+    
+    /**
+     *  Get the pool size class for a allocation size.
+     *
+     *  \param us_Size The allocation size in bytes.
+     *
+     *  \return The size class.
+     */
+    
+    static SizeClass GetSizeClass(size_t us_Size) noexcept;
+    
+    /**
+     *  Move a batch of free blocks from the shared pool to the calling thread.
+     *
+     *  \param e_Class The size class to refill.
+     */
+    
+    void Refill(SizeClass e_Class);
+    
+    /**
+     *  Move a batch of free blocks from the calling thread to the shared pool.
+     *
+     *  \param e_Class The size class to release.
+     *  \param us_Count The amount of blocks to release.
+     */
+    
+    void Release(SizeClass e_Class, size_t us_Count) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    Pool p_Pool[SIZE_CLASS_COUNT];
+    
+    // Slabs are kept for the lifetime of the process
+    std::mutex c_SlabMutex;
+    std::vector<MRH_Uint8*> v_Slab;
+    size_t us_SlabBytes;
+    
+    // Statistics
+    std::atomic<size_t> us_LiveBytes;
+    std::atomic<size_t> us_PeakBytes;
+    std::mutex c_StatisticsMutex;
+    std::chrono::steady_clock::time_point c_LastStatistics;
+
+protected:
+
+};
+
+#endif /* EventAllocator_h */
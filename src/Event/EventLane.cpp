@@ -0,0 +1,119 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+
+// External
+
+// Project
+#include "./EventLane.h"
+#include "./EventMeta.h"
+#include "../Logger/Logger.h"
+
+// Pre-defined
+namespace
+{
+    const char* p_LaneName[EventLane::LANE_COUNT] =
+    {
+        "control",
+        "default",
+        "bulk"
+    };
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+EventLane::EventLane() noexcept
+{
+    for (size_t i = 0; i < LANE_COUNT; ++i)
+    {
+        p_Statistics[i].u64_Count = 0;
+        p_Statistics[i].u64_WaitUS = 0;
+        p_Statistics[i].u64_MaxUS = 0;
+    }
+}
+
+EventLane::~EventLane() noexcept
+{}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+EventLane& EventLane::Singleton() noexcept
+{
+    static EventLane c_EventLane;
+    return c_EventLane;
+}
+
+//*************************************************************************************
+// Statistics
+//*************************************************************************************
+
+void EventLane::AddWait(Lane e_Lane, MRH_Uint64 u64_Count, MRH_Uint64 u64_WaitUS, MRH_Uint64 u64_MaxUS) noexcept
+{
+    Statistics& c_Statistics = p_Statistics[e_Lane];
+    
+    c_Statistics.u64_Count.fetch_add(u64_Count, std::memory_order_relaxed);
+    c_Statistics.u64_WaitUS.fetch_add(u64_WaitUS, std::memory_order_relaxed);
+    
+    MRH_Uint64 u64_Max = c_Statistics.u64_MaxUS.load(std::memory_order_relaxed);
+    
+    while (u64_Max < u64_MaxUS && c_Statistics.u64_MaxUS.compare_exchange_weak(u64_Max, u64_MaxUS, std::memory_order_relaxed) == false)
+    {}
+}
+
+void EventLane::LogStatistics() noexcept
+{
+    Logger& c_Logger = Logger::Singleton();
+    
+    for (size_t i = 0; i < LANE_COUNT; ++i)
+    {
+        Statistics& c_Statistics = p_Statistics[i];
+        MRH_Uint64 u64_Count = c_Statistics.u64_Count.load(std::memory_order_relaxed);
+        MRH_Uint64 u64_WaitUS = c_Statistics.u64_WaitUS.load(std::memory_order_relaxed);
+        MRH_Uint64 u64_MaxUS = c_Statistics.u64_MaxUS.exchange(0, std::memory_order_relaxed);
+        
+        c_Logger.Log(Logger::INFO, "Event lane " +
+                                   std::string(p_LaneName[i]) +
+                                   ": " +
+                                   std::to_string(u64_Count) +
+                                   " events sent, " +
+                                   std::to_string(u64_Count > 0 ? u64_WaitUS / u64_Count : 0) +
+                                   " us average wait, " +
+                                   std::to_string(u64_MaxUS) +
+                                   " us max wait.",
+                     "EventLane.cpp", __LINE__);
+    }
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+EventLane::Lane EventLane::GetLane(MRH_Uint32 u32_Type) const noexcept
+{
+    return EventMeta::Get(u32_Type).e_Lane;
+}
+
+MRH_Uint64 EventLane::GetTimeUS() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
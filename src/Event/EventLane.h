@@ -0,0 +1,159 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+ 
+#ifndef EventLane_h
+#define EventLane_h
+
+// C / C++
+#include <atomic>
+#include <chrono>
+
+// External
+#include <MRH_Event.h>
+
+// Project
+
+
+class EventLane
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef enum
+    {
+        CONTROL = 0, // Reset, permission, password and launch results
+        DEFAULT = 1,
+        BULK = 2, // Speech strings and notifications
+        
+        LANE_MAX = BULK,
+        
+        LANE_COUNT = LANE_MAX + 1
+        
+    }Lane;
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_EventLane EventLane class source.
+     */
+    
+    EventLane(EventLane const& c_EventLane) = delete;
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance. This function is thread safe.
+     *
+     *  \return The class instance.
+     */
+    
+    static EventLane& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Statistics
+    //*************************************************************************************
+    
+    /**
+     *  Add the wait times of events leaving a lane. This function is thread safe.
+     *
+     *  \param e_Lane The lane the events left.
+     *  \param u64_Count The amount of events.
+     *  \param u64_WaitUS The summed wait time in microseconds.
+     *  \param u64_MaxUS The longest wait time in microseconds.
+     */
+    
+    void AddWait(Lane e_Lane, MRH_Uint64 u64_Count, MRH_Uint64 u64_WaitUS, MRH_Uint64 u64_MaxUS) noexcept;
+    
+    /**
+     *  Log the lane statistics. Max wait times are given since the last call.
+     *  This function is thread safe.
+     */
+    
+    void LogStatistics() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the lane for a event type. This function is thread safe.
+     *
+     *  \param u32_Type The event type.
+     *
+     *  \return The event lane.
+     */
+    
+    Lane GetLane(MRH_Uint32 u32_Type) const noexcept;
+    
+    /**
+     *  Get the current lane wait time. This function is thread safe.
+     *
+     *  \return The time in microseconds.
+     */
+    
+    static MRH_Uint64 GetTimeUS() noexcept;
+
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Statistics
+    {
+        std::atomic<MRH_Uint64> u64_Count;
+        std::atomic<MRH_Uint64> u64_WaitUS;
+        std::atomic<MRH_Uint64> u64_MaxUS;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    EventLane() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~EventLane() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // Statistics
+    Statistics p_Statistics[LANE_COUNT];
+
+protected:
+
+};
+
+#endif /* EventLane_h */
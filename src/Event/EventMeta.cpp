@@ -0,0 +1,150 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+
+// External
+
+// Project
+#include "./EventMeta.h"
+
+// Pre-defined
+namespace
+{
+    /**
+     *  Event Version 1
+     *
+     *  { Type, Name, Direction, Permission, Permission Mask, User Service,
+     *    Password Exempt, Group Exempt, Lane, Min Data Size }
+     */
+    
+    constexpr EventMeta::Info p_Entry[] =
+    {
+        { MRH_EVENT_UNK, "MRH_EVENT_UNK", EventMeta::CORE, EventMeta::PERMISSION_NEVER, 0, false, true, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_PERMISSION_DENIED, "MRH_EVENT_PERMISSION_DENIED", EventMeta::CORE, EventMeta::PERMISSION_ALWAYS, EventMeta::u32_PermissionAny, false, true, false, EventLane::CONTROL, sizeof(MRH_Uint32) },
+        { MRH_EVENT_PASSWORD_REQUIRED, "MRH_EVENT_PASSWORD_REQUIRED", EventMeta::CORE, EventMeta::PERMISSION_NEVER, 0, false, true, false, EventLane::CONTROL, sizeof(MRH_Uint32) },
+        { MRH_EVENT_NOT_IMPLEMENTED_S, "MRH_EVENT_NOT_IMPLEMENTED_S", EventMeta::SERVICE, EventMeta::PERMISSION_ALWAYS, EventMeta::u32_PermissionAny, false, true, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_PS_RESET_REQUEST_U, "MRH_EVENT_PS_RESET_REQUEST_U", EventMeta::USER, EventMeta::PERMISSION_ALWAYS, EventMeta::u32_PermissionAny, false, true, false, EventLane::CONTROL, 0 },
+        { MRH_EVENT_PS_RESET_ACKNOLEDGED_U, "MRH_EVENT_PS_RESET_ACKNOLEDGED_U", EventMeta::CORE, EventMeta::PERMISSION_ALWAYS, EventMeta::u32_PermissionAny, false, true, false, EventLane::CONTROL, 0 },
+        { MRH_EVENT_CUSTOM_AVAIL_U, "MRH_EVENT_CUSTOM_AVAIL_U", EventMeta::USER, PackageConfiguration::CUSTOM, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_CUSTOM_CUSTOM_COMMAND_U, "MRH_EVENT_CUSTOM_CUSTOM_COMMAND_U", EventMeta::USER, PackageConfiguration::CUSTOM, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_CUSTOM_AVAIL_S, "MRH_EVENT_CUSTOM_AVAIL_S", EventMeta::SERVICE, PackageConfiguration::CUSTOM, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_CUSTOM_CUSTOM_COMMAND_S, "MRH_EVENT_CUSTOM_CUSTOM_COMMAND_S", EventMeta::SERVICE, PackageConfiguration::CUSTOM, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_LISTEN_AVAIL_U, "MRH_EVENT_LISTEN_AVAIL_U", EventMeta::USER, PackageConfiguration::LISTEN, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_LISTEN_GET_METHOD_U, "MRH_EVENT_LISTEN_GET_METHOD_U", EventMeta::USER, PackageConfiguration::LISTEN, EventMeta::LISTEN_GET_METHOD, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_LISTEN_CUSTOM_COMMAND_U, "MRH_EVENT_LISTEN_CUSTOM_COMMAND_U", EventMeta::USER, PackageConfiguration::LISTEN, EventMeta::LISTEN_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_LISTEN_AVAIL_S, "MRH_EVENT_LISTEN_AVAIL_S", EventMeta::SERVICE, PackageConfiguration::LISTEN, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_LISTEN_STRING_S, "MRH_EVENT_LISTEN_STRING_S", EventMeta::SERVICE, PackageConfiguration::LISTEN, EventMeta::LISTEN_LISTEN, false, false, true, EventLane::BULK, 0 },
+        { MRH_EVENT_LISTEN_GET_METHOD_S, "MRH_EVENT_LISTEN_GET_METHOD_S", EventMeta::SERVICE, PackageConfiguration::LISTEN, EventMeta::LISTEN_GET_METHOD, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_LISTEN_CUSTOM_COMMAND_S, "MRH_EVENT_LISTEN_CUSTOM_COMMAND_S", EventMeta::SERVICE, PackageConfiguration::LISTEN, EventMeta::LISTEN_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_SAY_AVAIL_U, "MRH_EVENT_SAY_AVAIL_U", EventMeta::USER, PackageConfiguration::SAY, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_SAY_STRING_U, "MRH_EVENT_SAY_STRING_U", EventMeta::USER, PackageConfiguration::SAY, EventMeta::SAY_SAY, false, false, false, EventLane::BULK, 0 },
+        { MRH_EVENT_SAY_GET_METHOD_U, "MRH_EVENT_SAY_GET_METHOD_U", EventMeta::USER, PackageConfiguration::SAY, EventMeta::SAY_GET_METHOD, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_SAY_NOTIFICATION_APP_U, "MRH_EVENT_SAY_NOTIFICATION_APP_U", EventMeta::USER, PackageConfiguration::SAY, EventMeta::SAY_NOTIFICATION_APP, false, false, false, EventLane::BULK, 0 },
+        { MRH_EVENT_SAY_NOTIFICATION_SERVICE_U, "MRH_EVENT_SAY_NOTIFICATION_SERVICE_U", EventMeta::USER, PackageConfiguration::SAY, EventMeta::SAY_NOTIFICATION_SERVICE, true, true, false, EventLane::BULK, 0 },
+        { MRH_EVENT_SAY_CUSTOM_COMMAND_U, "MRH_EVENT_SAY_CUSTOM_COMMAND_U", EventMeta::USER, PackageConfiguration::SAY, EventMeta::SAY_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_SAY_AVAIL_S, "MRH_EVENT_SAY_AVAIL_S", EventMeta::SERVICE, PackageConfiguration::SAY, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_SAY_STRING_S, "MRH_EVENT_SAY_STRING_S", EventMeta::SERVICE, PackageConfiguration::SAY, EventMeta::SAY_SAY, false, true, true, EventLane::BULK, 0 },
+        { MRH_EVENT_SAY_GET_METHOD_S, "MRH_EVENT_SAY_GET_METHOD_S", EventMeta::SERVICE, PackageConfiguration::SAY, EventMeta::SAY_GET_METHOD, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_SAY_NOTIFICATION_APP_S, "MRH_EVENT_SAY_NOTIFICATION_APP_S", EventMeta::SERVICE, PackageConfiguration::SAY, EventMeta::SAY_NOTIFICATION_APP, false, false, false, EventLane::BULK, 0 },
+        { MRH_EVENT_SAY_CUSTOM_COMMAND_S, "MRH_EVENT_SAY_CUSTOM_COMMAND_S", EventMeta::SERVICE, PackageConfiguration::SAY, EventMeta::SAY_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_PASSWORD_AVAIL_U, "MRH_EVENT_PASSWORD_AVAIL_U", EventMeta::USER, PackageConfiguration::PASSWORD, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_PASSWORD_CHECK_U, "MRH_EVENT_PASSWORD_CHECK_U", EventMeta::USER, PackageConfiguration::PASSWORD, EventMeta::PASSWORD_CHECK, false, true, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_PASSWORD_SET_U, "MRH_EVENT_PASSWORD_SET_U", EventMeta::USER, PackageConfiguration::PASSWORD, EventMeta::PASSWORD_SET, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_PASSWORD_CUSTOM_COMMAND_U, "MRH_EVENT_PASSWORD_CUSTOM_COMMAND_U", EventMeta::USER, PackageConfiguration::PASSWORD, EventMeta::PASSWORD_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_PASSWORD_AVAIL_S, "MRH_EVENT_PASSWORD_AVAIL_S", EventMeta::SERVICE, PackageConfiguration::PASSWORD, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_PASSWORD_CHECK_S, "MRH_EVENT_PASSWORD_CHECK_S", EventMeta::SERVICE, PackageConfiguration::PASSWORD, EventMeta::PASSWORD_CHECK, false, true, false, EventLane::CONTROL, 0 },
+        { MRH_EVENT_PASSWORD_SET_S, "MRH_EVENT_PASSWORD_SET_S", EventMeta::SERVICE, PackageConfiguration::PASSWORD, EventMeta::PASSWORD_SET, false, false, false, EventLane::CONTROL, 0 },
+        { MRH_EVENT_PASSWORD_CUSTOM_COMMAND_S, "MRH_EVENT_PASSWORD_CUSTOM_COMMAND_S", EventMeta::SERVICE, PackageConfiguration::PASSWORD, EventMeta::PASSWORD_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_AVAIL_U, "MRH_EVENT_USER_AVAIL_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_DOCUMENTS_U, "MRH_EVENT_USER_ACCESS_DOCUMENTS_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_DOCUMENTS_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_PICTURES_U, "MRH_EVENT_USER_ACCESS_PICTURES_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_PICTURES_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_MUSIC_U, "MRH_EVENT_USER_ACCESS_MUSIC_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_MUSIC_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_VIDEOS_U, "MRH_EVENT_USER_ACCESS_VIDEOS_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_VIDEOS_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_DOWNLOADS_U, "MRH_EVENT_USER_ACCESS_DOWNLOADS_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_DOWNLOADS_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_CLIPBOARD_U, "MRH_EVENT_USER_ACCESS_CLIPBOARD_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_CLIPBOARD_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_INFO_PERSON_U, "MRH_EVENT_USER_ACCESS_INFO_PERSON_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_INFO_PERSON_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_U, "MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_INFO_RESIDENCE_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_CLEAR_U, "MRH_EVENT_USER_ACCESS_CLEAR_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::u32_PermissionUserAccess, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_GET_LOCATION_U, "MRH_EVENT_USER_GET_LOCATION_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_GET_LOCATION, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_CUSTOM_COMMAND_U, "MRH_EVENT_USER_CUSTOM_COMMAND_U", EventMeta::USER, PackageConfiguration::USER, EventMeta::USER_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_AVAIL_S, "MRH_EVENT_USER_AVAIL_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_DOCUMENTS_S, "MRH_EVENT_USER_ACCESS_DOCUMENTS_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_DOCUMENTS_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_PICTURES_S, "MRH_EVENT_USER_ACCESS_PICTURES_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_PICTURES_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_MUSIC_S, "MRH_EVENT_USER_ACCESS_MUSIC_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_MUSIC_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_VIDEOS_S, "MRH_EVENT_USER_ACCESS_VIDEOS_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_VIDEOS_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_DOWNLOADS_S, "MRH_EVENT_USER_ACCESS_DOWNLOADS_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_DOWNLOADS_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_CLIPBOARD_S, "MRH_EVENT_USER_ACCESS_CLIPBOARD_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_CLIPBOARD_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_INFO_PERSON_S, "MRH_EVENT_USER_ACCESS_INFO_PERSON_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_INFO_PERSON_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_S, "MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_INFO_RESIDENCE_ACCESS, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_ACCESS_CLEAR_S, "MRH_EVENT_USER_ACCESS_CLEAR_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::u32_PermissionUserAccess, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_GET_LOCATION_S, "MRH_EVENT_USER_GET_LOCATION_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_GET_LOCATION, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_USER_CUSTOM_COMMAND_S, "MRH_EVENT_USER_CUSTOM_COMMAND_S", EventMeta::SERVICE, PackageConfiguration::USER, EventMeta::USER_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_AVAIL_U, "MRH_EVENT_APP_AVAIL_U", EventMeta::USER, PackageConfiguration::APP, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_U, "MRH_EVENT_APP_LAUNCH_SOA_U", EventMeta::USER, PackageConfiguration::APP, EventMeta::APPLICATION_LAUNCH, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_TIMER_U, "MRH_EVENT_APP_LAUNCH_SOA_TIMER_U", EventMeta::USER, PackageConfiguration::APP, EventMeta::APPLICATION_LAUNCH_TIMER, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_CLEAR_U, "MRH_EVENT_APP_LAUNCH_SOA_CLEAR_U", EventMeta::USER, PackageConfiguration::APP, EventMeta::APPLICATION_CLEAR_LAUNCH, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_U, "MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_U", EventMeta::USER, PackageConfiguration::APP, EventMeta::APPLICATION_CLEAR_LAUNCH_TIMER, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_CUSTOM_COMMAND_U, "MRH_EVENT_APP_CUSTOM_COMMAND_U", EventMeta::USER, PackageConfiguration::APP, EventMeta::APPLICATION_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_AVAIL_S, "MRH_EVENT_APP_AVAIL_S", EventMeta::SERVICE, PackageConfiguration::APP, EventMeta::u32_PermissionAny, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_S, "MRH_EVENT_APP_LAUNCH_SOA_S", EventMeta::SERVICE, PackageConfiguration::APP, EventMeta::APPLICATION_LAUNCH, false, false, false, EventLane::CONTROL, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_TIMER_S, "MRH_EVENT_APP_LAUNCH_SOA_TIMER_S", EventMeta::SERVICE, PackageConfiguration::APP, EventMeta::APPLICATION_LAUNCH_TIMER, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_TIMER_REMINDER_S, "MRH_EVENT_APP_LAUNCH_SOA_TIMER_REMINDER_S", EventMeta::SERVICE, EventMeta::PERMISSION_ALWAYS, EventMeta::u32_PermissionAny, false, true, true, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_CLEAR_S, "MRH_EVENT_APP_LAUNCH_SOA_CLEAR_S", EventMeta::SERVICE, PackageConfiguration::APP, EventMeta::APPLICATION_CLEAR_LAUNCH, false, false, false, EventLane::CONTROL, 0 },
+        { MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_S, "MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_S", EventMeta::SERVICE, PackageConfiguration::APP, EventMeta::APPLICATION_CLEAR_LAUNCH_TIMER, false, false, false, EventLane::DEFAULT, 0 },
+        { MRH_EVENT_APP_CUSTOM_COMMAND_S, "MRH_EVENT_APP_CUSTOM_COMMAND_S", EventMeta::SERVICE, PackageConfiguration::APP, EventMeta::APPLICATION_CUSTOM_COMMAND, false, false, false, EventLane::DEFAULT, 0 }
+    };
+    
+    constexpr EventMeta::Info c_Unknown = { MRH_EVENT_UNK, "UNKNOWN EVENT", EventMeta::CORE, EventMeta::PERMISSION_NEVER, 0, false, false, false, EventLane::DEFAULT, 0 };
+}
+
+
+//*************************************************************************************
+// Table
+//*************************************************************************************
+
+// @NOTE: Entries are placed by type, the entry order does not matter
+static constexpr EventMeta::Table CreateTable() noexcept
+{
+    EventMeta::Table c_Table = {};
+    
+    for (auto& Entry : p_Entry)
+    {
+        c_Table.p_Info[Entry.u32_Type] = Entry;
+    }
+    
+    c_Table.c_Unknown = c_Unknown;
+    
+    return c_Table;
+}
+
+static constexpr bool GetTableComplete(EventMeta::Table const& c_Table) noexcept
+{
+    for (auto& Entry : c_Table.p_Info)
+    {
+        if (Entry.p_Name == NULL)
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+static_assert(GetTableComplete(CreateTable()) == true, "Event metadata missing for event type!");
+
+const EventMeta::Table EventMeta::c_Table = CreateTable();
@@ -0,0 +1,227 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+ 
+#ifndef EventMeta_h
+#define EventMeta_h
+
+// C / C++
+
+// External
+#include <MRH_Event.h>
+
+// Project
+#include "../Package/Content/PackageConfiguration.h"
+#include "./EventLane.h"
+
+
+class EventMeta
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef enum
+    {
+        CORE = 0, // Created by mrhcore
+        USER = 1, // Sent by user applications and user services (_U)
+        SERVICE = 2, // Sent by platform services (_S)
+        
+        DIRECTION_MAX = SERVICE,
+        
+        DIRECTION_COUNT = DIRECTION_MAX + 1
+        
+    }Direction;
+    
+    // @NOTE: Package permissions use the first entries, the rest are fixed
+    typedef enum
+    {
+        PERMISSION_ALWAYS = PackageConfiguration::EVENT_PERMISSION_LIST_COUNT, // All bits set
+        PERMISSION_NEVER = PERMISSION_ALWAYS + 1, // No bits set
+        
+        PERMISSION_MAX = PERMISSION_NEVER,
+        
+        PERMISSION_COUNT = PERMISSION_MAX + 1
+        
+    }Permission;
+    
+    // @NOTE: Bit flags are used (1, 2, 4, 8, etc.) to allow for combining permissions!
+    typedef enum
+    {
+        /* Event Version 1 */
+        
+        CUSTOM_NONE = 0,                         // No custom service permissions
+        CUSTOM_USABLE = 1,                       // Custom service usage enabled
+        
+    }PermissionCustom;
+    
+    typedef enum
+    {
+        /* Event Version 1 */
+        
+        APPLICATION_NONE = 0,                    // No application permissions
+        APPLICATION_LAUNCH = 1,                  // Launch application by path
+        APPLICATION_CLEAR_LAUNCH = 2,            // Clear application launch request
+        APPLICATION_LAUNCH_TIMER = 4,            // Timed application launch by path
+        APPLICATION_CLEAR_LAUNCH_TIMER = 8,      // Clear all timed application launches request
+        APPLICATION_CUSTOM_COMMAND = 16,         // Allow sending and recieving of custom commands
+        
+    }PermissionApplication;
+    
+    typedef enum
+    {
+        /* Event Version 1 */
+        
+        LISTEN_NONE = 0,                         // No listen permissions
+        LISTEN_LISTEN = 1,                       // Speech listen events
+        LISTEN_GET_METHOD = 2,                   // Get speech input method
+        LISTEN_CUSTOM_COMMAND = 4,               // Allow sending and recieving of custom commands
+        
+    }PermissionListen;
+    
+    typedef enum
+    {
+        /* Event Version 1 */
+        
+        SAY_NONE = 0,                            // No say permissions
+        SAY_SAY = 1,                             // Speech say events
+        SAY_GET_METHOD = 2,                      // Get speech output method
+        SAY_NOTIFICATION_APP = 4,                // Send notification from app
+        SAY_NOTIFICATION_SERVICE = 8,            // Send notification from service
+        SAY_CUSTOM_COMMAND = 16,                  // Allow sending and recieving of custom commands
+        
+    }PermissionSay;
+    
+    typedef enum
+    {
+        /* Event Version 1 */
+        
+        PASSWORD_NONE = 0,                       // No password permissions
+        PASSWORD_CHECK = 1,                      // Check user password
+        PASSWORD_SET = 2,                        // Set user password
+        PASSWORD_CUSTOM_COMMAND = 4,             // Allow sending and recieving of custom commands
+        
+    }PermissionPassword;
+    
+    typedef enum
+    {
+        /* Event Version 1 */
+        
+        USER_NONE = 0,                           // No user permissions
+        USER_DOCUMENTS_ACCESS = 1,               // Access user documents
+        USER_PICTURES_ACCESS = 2,                // Access user pictures
+        USER_MUSIC_ACCESS = 4,                   // Access user music
+        USER_VIDEOS_ACCESS = 8,                  // Access user videos
+        USER_DOWNLOADS_ACCESS = 16,              // Access user downloads
+        USER_CLIPBOARD_ACCESS = 32,              // Access user clipboard
+        USER_INFO_PERSON_ACCESS = 64,            // Access user person info
+        USER_INFO_RESIDENCE_ACCESS = 128,        // Access user residence info
+        USER_GET_LOCATION = 256,                 // Request user location
+        USER_CUSTOM_COMMAND = 512,               // Allow sending and recieving of custom commands
+        
+    }PermissionUser;
+    
+    struct Info
+    {
+        MRH_Uint32 u32_Type;
+        const char* p_Name;
+        
+        // Sender of the event
+        Direction e_Direction;
+        
+        // Permission list entry, given if any mask bit is set
+        MRH_Uint32 u32_Permission;
+        MRH_Uint32 u32_PermissionMask;
+        
+        // Available to user services instead of user applications
+        bool b_UserService;
+        
+        // Never password protected, even if listed
+        bool b_PasswordExempt;
+        
+        // Sent to anyone, the event group is not checked
+        bool b_GroupExempt;
+        
+        // Send lane
+        EventLane::Lane e_Lane;
+        
+        // Smallest valid event data size
+        MRH_Uint32 u32_MinDataSize;
+    };
+    
+    struct Table
+    {
+        // Indexed by event type
+        Info p_Info[MRH_EVENT_TYPE_COUNT];
+        Info c_Unknown;
+    };
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the metadata for a event type. This function is thread safe.
+     *
+     *  \param u32_Type The event type.
+     *
+     *  \return The event metadata, unknown types share a single entry.
+     */
+    
+    static inline Info const& Get(MRH_Uint32 u32_Type) noexcept
+    {
+        return u32_Type <= MRH_EVENT_TYPE_MAX ? c_Table.p_Info[u32_Type] : c_Table.c_Unknown;
+    }
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    static constexpr MRH_Uint32 u32_PermissionAny = 0xFFFFFFFF;
+    static constexpr MRH_Uint32 u32_PermissionUserAccess = USER_DOCUMENTS_ACCESS |
+                                                           USER_PICTURES_ACCESS |
+                                                           USER_MUSIC_ACCESS |
+                                                           USER_VIDEOS_ACCESS |
+                                                           USER_DOWNLOADS_ACCESS |
+                                                           USER_CLIPBOARD_ACCESS |
+                                                           USER_INFO_PERSON_ACCESS |
+                                                           USER_INFO_RESIDENCE_ACCESS;
+
+private:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. Disabled for this class.
+     */
+    
+    EventMeta() = delete;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    static const Table c_Table;
+
+protected:
+
+};
+
+#endif /* EventMeta_h */
@@ -15,6 +15,7 @@
  */
 
 // C / C++
+#include <algorithm>
 #include <cstring>
 #include <new>
 
@@ -22,8 +23,63 @@
 
 // Project
 #include "./EventQueue.h"
+#include "../Logger/Logger.h"
 #include "../Logger/EventLogger.h"
 
+// Pre-defined
+namespace
+{
+    // Event frame header: Group ID, Type, Data Size
+    constexpr size_t us_FrameHeaderSize = sizeof(MRH_Uint32) * 3;
+    
+    // Batch header (v2): Magic, Count, Length, Sequence
+    // @NOTE: Records follow as Group ID, varint Type, varint Data Size, Data
+    constexpr MRH_Uint32 u32_BatchMagic = 0x3248524D; // "MRH2"
+    constexpr size_t us_BatchHeaderSize = sizeof(MRH_Uint32) * 4;
+    constexpr size_t us_RecordHeaderMin = sizeof(MRH_Uint32) + 2;
+    constexpr size_t us_RecordHeaderMax = sizeof(MRH_Uint32) + 10;
+    
+    // Largest batch length or frame data size accepted from a child,
+    // anything larger is malformed
+    constexpr size_t us_BatchLengthMax = 65536 * 16;
+    
+    inline MRH_Uint8* WriteVarint(MRH_Uint8* p_Buffer, MRH_Uint32 u32_Value) noexcept
+    {
+        while (u32_Value > 0x7F)
+        {
+            *p_Buffer++ = static_cast<MRH_Uint8>(u32_Value | 0x80);
+            u32_Value >>= 7;
+        }
+        
+        *p_Buffer++ = static_cast<MRH_Uint8>(u32_Value);
+        return p_Buffer;
+    }
+    
+    inline bool ReadVarint(const MRH_Uint8*& p_Buffer, const MRH_Uint8* p_End, MRH_Uint32& u32_Value) noexcept
+    {
+        u32_Value = 0;
+        
+        for (MRH_Uint32 u32_Shift = 0; u32_Shift < 35 && p_Buffer < p_End; u32_Shift += 7)
+        {
+            MRH_Uint8 u8_Byte = *p_Buffer++;
+            u32_Value |= static_cast<MRH_Uint32>(u8_Byte & 0x7F) << u32_Shift;
+            
+            if ((u8_Byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        
+        return false;
+    }
+    
+    // Default recieve buffer size, matches the default pipe capacity
+    constexpr size_t us_RecieveBufferSize = 65536;
+    
+    // Events staged from higher lanes before a waiting lower lane gets one
+    constexpr MRH_Uint32 u32_LaneStarvationLimit = 32;
+}
+
 
 //*************************************************************************************
 // Constructor / Destructor
@@ -31,17 +87,41 @@
 
 // @NOTE: Pi doesn't like [ 0 ... X ] = e_Type
 EventQueue::EventQueue(TransmissionSource::SourceType e_Type) : p_Queue { e_Type,
-                                                                          e_Type } // All queues should use param e_Type
-{}
+                                                                          e_Type }, // All queues should use param e_Type
+                                                                us_SendDepth(0),
+                                                                u64_SendDrained(0),
+                                                                u64_LastDrained(0),
+                                                                c_LastStatistics(std::chrono::steady_clock::now()),
+                                                                u32_SendWireVersion(1)
+{
+#if MRH_CORE_EVENT_TRACING > 0
+    u32_TraceEndpoint = 0;
+#endif
+    
+    for (size_t i = 0; i < EventLane::LANE_COUNT; ++i)
+    {
+        p_Lane[i].us_Head = 0;
+        p_Lane[i].u32_Skipped = 0;
+    }
+}
 
 EventQueue::~EventQueue() noexcept
 {}
 
 EventQueue::Queue::Queue(TransmissionSource::SourceType e_Type) : p_Source(NULL),
-                                                                  e_Data(Queue::TransmissionData::FINISHED),
-                                                                  u32_BytesProcessed(0),
-                                                                  u32_Type(MRH_EVENT_UNK),
-                                                                  u32_DataSize(0)
+                                                                  us_BufferSize(us_RecieveBufferSize),
+                                                                  u32_BatchLimit(0),
+                                                                  b_Batched(false),
+                                                                  b_PeerBatched(false),
+                                                                  u32_Sequence(0),
+                                                                  b_Failed(false),
+                                                                  us_QueueHead(0),
+                                                                  us_VectorBase(0),
+                                                                  us_VectorPos(0),
+                                                                  u32_BatchSize(0),
+                                                                  u32_BatchSent(0),
+                                                                  us_BufferStart(0),
+                                                                  us_BufferEnd(0)
 {
     // Create source
     try
@@ -53,6 +133,9 @@ EventQueue::Queue::Queue(TransmissionSource::SourceType e_Type) : p_Source(NULL)
                 p_Source = new SourceMRHCKM();
                 break;
 #endif
+            case TransmissionSource::SourceType::SHARED_MEMORY:
+                p_Source = new SourceSharedMemory();
+                break;
             
             default:
                 p_Source = new SourcePipe();
@@ -79,22 +162,46 @@ EventQueue::Queue::~Queue() noexcept
 
 void EventQueue::Queue::Reset(QueueType e_Queue)
 {
-    // Reset current transmission
-    u32_BytesProcessed = 0;
-    u32_Type = MRH_EVENT_UNK;
-    u32_DataSize = 0;
-    v_Data.clear();
+    // Reset current transmission, keep events not sent yet
+    v_Queue.erase(v_Queue.begin(), v_Queue.begin() + us_QueueHead + u32_BatchSent);
+    us_QueueHead = 0;
+    v_Header.clear();
+    v_Vector.clear();
+    us_VectorBase = 0;
+    us_VectorPos = 0;
+    u32_BatchSize = 0;
+    u32_BatchSent = 0;
+    
+    // Drop all buffered data
+    us_BufferStart = 0;
+    us_BufferEnd = 0;
+    
+    // New source, new batch sequence
+    b_PeerBatched = false;
+    u32_Sequence = 0;
+    b_Failed = false;
     
     // Set initial state
     switch (e_Queue)
     {
-        // Read starts waiting for the first element
+        // Read requires the recieve buffer
         case C_W_P_R:
-            e_Data = Queue::TransmissionData::GROUP_ID;
+            try
+            {
+                // @NOTE: Buffers grown for large frames shrink back here
+                if (v_Buffer.size() != us_BufferSize)
+                {
+                    v_Buffer.resize(us_BufferSize);
+                    v_Buffer.shrink_to_fit();
+                }
+            }
+            catch (std::exception& e)
+            {
+                throw EventException("Failed to allocate recieve buffer: " + std::string(e.what()));
+            }
             break;
             
         default:
-            e_Data = Queue::TransmissionData::FINISHED;
             break;
     }
     
@@ -120,6 +227,17 @@ void EventQueue::Reset()
         {
             p_Queue[i].Reset(static_cast<EventQueue::QueueType>(i));
         }
+        
+        // Lanes keep their events, they are staged after the reset
+        size_t us_Depth = p_Queue[P_W_C_R].v_Queue.size();
+        
+        for (size_t j = 0; j < EventLane::LANE_COUNT; ++j)
+        {
+            us_Depth += p_Lane[j].v_Event.size() - p_Lane[j].us_Head;
+        }
+        
+        us_SendDepth = us_Depth;
+        u32_SendWireVersion = 1;
     }
     catch (EventException& e)
     {
@@ -128,140 +246,389 @@ void EventQueue::Reset()
 }
 
 //*************************************************************************************
-// Update
+// Transport
 //*************************************************************************************
 
-bool EventQueue::Queue::CheckNextData(TransmissionData e_NextData, MRH_Uint32 u32_Required) noexcept
+void EventQueue::SetTransport(size_t us_Capacity, size_t us_ReadBatchSize, MRH_Uint32 u32_WriteBatchSize) noexcept
 {
-    if (u32_BytesProcessed >= u32_Required)
+    for (size_t i = 0; i < QUEUE_COUNT; ++i)
     {
-        u32_BytesProcessed = 0;
-        e_Data = e_NextData;
-        
-        return true;
+        p_Queue[i].p_Source->SetCapacity(us_Capacity);
     }
     
-    return false;
+    // A recieve buffer smaller than a frame or batch header could never parse anything
+    p_Queue[C_W_P_R].us_BufferSize = (us_ReadBatchSize > 0 ? std::max(us_ReadBatchSize, std::max(us_FrameHeaderSize, us_BatchHeaderSize)) : us_RecieveBufferSize);
+    p_Queue[P_W_C_R].u32_BatchLimit = u32_WriteBatchSize;
+}
+
+void EventQueue::SetWireVersion(MRH_Uint32 u32_WireVersion) noexcept
+{
+    p_Queue[C_W_P_R].b_Batched = (u32_WireVersion > 1);
 }
 
+#if MRH_CORE_EVENT_TRACING > 0
+void EventQueue::SetTraceEndpoint(std::string const& s_Name) noexcept
+{
+    u32_TraceEndpoint = EventTrace::Singleton().GetEndpoint(s_Name);
+}
+#endif
+
 //*************************************************************************************
 // Recieve
 //*************************************************************************************
 
-void EventQueue::Queue::Read(MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept
+EventQueue::Queue::TransmissionState EventQueue::Queue::CloseMalformed(std::string const& s_Reason) noexcept
 {
-    ssize_t ss_Read;
+    Logger::Singleton().Log(Logger::ERROR, "Closing event queue for " + s_Reason + "!",
+                            "EventQueue.cpp", __LINE__);
     
-    if ((ss_Read = p_Source->Read(&(p_Data[u32_BytesProcessed]), u32_Length - u32_BytesProcessed)) > 0)
+    try
     {
-        u32_BytesProcessed += ss_Read;
+        p_Source->Close();
     }
+    catch (...)
+    {}
+    
+    b_Failed = true;
+    return TransmissionState::FAILED;
+}
+
+ssize_t EventQueue::Queue::FillBuffer() noexcept
+{
+    // Move the remaining partial frame to the buffer start to
+    // keep every frame contiguous
+    if (us_BufferStart == us_BufferEnd)
+    {
+        us_BufferStart = 0;
+        us_BufferEnd = 0;
+    }
+    else if (us_BufferStart > 0)
+    {
+        std::memmove(v_Buffer.data(), &(v_Buffer[us_BufferStart]), us_BufferEnd - us_BufferStart);
+        us_BufferEnd -= us_BufferStart;
+        us_BufferStart = 0;
+    }
+    
+    // Read everything available which fits
+    ssize_t ss_Read = p_Source->Read(&(v_Buffer[us_BufferEnd]), v_Buffer.size() - us_BufferEnd);
+    
+    if (ss_Read > 0)
+    {
+        us_BufferEnd += ss_Read;
+    }
+    
+    return ss_Read;
 }
 
 EventQueue::Queue::TransmissionState EventQueue::Queue::RecieveEvent(size_t const& us_ReserveStep) noexcept
 {
-    bool b_NextData;
+    size_t us_Available = us_BufferEnd - us_BufferStart;
     
-    switch (e_Data)
+    if (us_Available < us_FrameHeaderSize)
     {
-        case TransmissionData::GROUP_ID:
-            Read((MRH_Uint8*)(&u32_GroupID), sizeof(u32_GroupID));
-            b_NextData = CheckNextData(TransmissionData::TYPE, sizeof(u32_GroupID));
-            break;
-            
-        case TransmissionData::TYPE:
-            Read((MRH_Uint8*)(&u32_Type), sizeof(u32_Type));
-            b_NextData = CheckNextData(TransmissionData::DATA_SIZE, sizeof(u32_Type));
-            break;
-            
-        case TransmissionData::DATA_SIZE:
-            Read((MRH_Uint8*)(&u32_DataSize), sizeof(u32_DataSize));
-            
-            // Check result manually since we need to know the datasize value for the next state
-            if (u32_BytesProcessed < sizeof(u32_DataSize))
+        return TransmissionState::CONTINUE;
+    }
+    
+    // Read header in place, the buffer holds no alignment guarantees
+    const MRH_Uint8* p_Frame = &(v_Buffer[us_BufferStart]);
+    MRH_Uint32 u32_FrameGroupID;
+    MRH_Uint32 u32_FrameType;
+    MRH_Uint32 u32_FrameDataSize;
+    
+    std::memcpy(&u32_FrameGroupID, p_Frame, sizeof(MRH_Uint32));
+    
+    // Batches take the place of the group id with their magic
+    if (b_Batched == true && u32_FrameGroupID == u32_BatchMagic)
+    {
+        return RecieveBatch(us_ReserveStep);
+    }
+    
+    std::memcpy(&u32_FrameType, p_Frame + sizeof(MRH_Uint32), sizeof(MRH_Uint32));
+    std::memcpy(&u32_FrameDataSize, p_Frame + (sizeof(MRH_Uint32) * 2), sizeof(MRH_Uint32));
+    
+    // Same bound as batches, a single event never exceeds it
+    if (u32_FrameDataSize > us_BatchLengthMax)
+    {
+        return CloseMalformed("event " +
+                              std::to_string(u32_FrameType) +
+                              " with data size " +
+                              std::to_string(u32_FrameDataSize));
+    }
+    
+    size_t us_FrameSize = us_FrameHeaderSize + u32_FrameDataSize;
+    
+    if (us_Available < us_FrameSize)
+    {
+        // Partial frame, grow if the frame can never fit
+        try
+        {
+            if (v_Buffer.size() < us_FrameSize)
             {
-                b_NextData = false;
-                break;
+                v_Buffer.resize(us_FrameSize);
             }
-            
-            // Add required data buffer space and set state
-            if (v_Data.size() < u32_DataSize)
+        }
+        catch (...)
+        {
+            return TransmissionState::FAILED;
+        }
+        
+        return TransmissionState::CONTINUE;
+    }
+    
+    try
+    {
+        // Grow if needed
+        if (v_Queue.size() == v_Queue.capacity())
+        {
+            v_Queue.reserve(v_Queue.capacity() + us_ReserveStep);
+        }
+        
+        v_Queue.emplace_back(u32_FrameGroupID,
+                             u32_FrameType,
+                             p_Frame + us_FrameHeaderSize,
+                             u32_FrameDataSize);
+    }
+    catch (...)
+    {
+        return TransmissionState::FAILED;
+    }
+    
+    us_BufferStart += us_FrameSize;
+    
+    return TransmissionState::COMPLETED;
+}
+
+EventQueue::Queue::TransmissionState EventQueue::Queue::RecieveBatch(size_t const& us_ReserveStep) noexcept
+{
+    size_t us_Available = us_BufferEnd - us_BufferStart;
+    
+    if (us_Available < us_BatchHeaderSize)
+    {
+        return TransmissionState::CONTINUE;
+    }
+    
+    const MRH_Uint8* p_Batch = &(v_Buffer[us_BufferStart]);
+    MRH_Uint32 u32_BatchCount;
+    MRH_Uint32 u32_BatchLength;
+    MRH_Uint32 u32_BatchSequence;
+    
+    std::memcpy(&u32_BatchCount, p_Batch + sizeof(MRH_Uint32), sizeof(MRH_Uint32));
+    std::memcpy(&u32_BatchLength, p_Batch + (sizeof(MRH_Uint32) * 2), sizeof(MRH_Uint32));
+    std::memcpy(&u32_BatchSequence, p_Batch + (sizeof(MRH_Uint32) * 3), sizeof(MRH_Uint32));
+    
+    // Never grow the buffer for a length no sender would write
+    if (u32_BatchLength > us_BatchLengthMax)
+    {
+        return CloseMalformed("batch " +
+                              std::to_string(u32_BatchSequence) +
+                              " with length " +
+                              std::to_string(u32_BatchLength));
+    }
+    
+    size_t us_BatchSize = us_BatchHeaderSize + u32_BatchLength;
+    
+    if (us_Available < us_BatchSize)
+    {
+        // Partial batch, grow if the batch can never fit
+        try
+        {
+            if (v_Buffer.size() < us_BatchSize)
             {
-                v_Data.insert(v_Data.end(), u32_DataSize - v_Data.size(), 0);
+                v_Buffer.resize(us_BatchSize);
+            }
+        }
+        catch (...)
+        {
+            return TransmissionState::FAILED;
+        }
+        
+        return TransmissionState::CONTINUE;
+    }
+    
+    // The whole batch is buffered, records only have to stay inside it
+    const MRH_Uint8* p_Record = p_Batch + us_BatchHeaderSize;
+    const MRH_Uint8* p_End = p_Record + u32_BatchLength;
+    size_t us_QueueSize = v_Queue.size();
+    bool b_Valid = (u32_BatchCount > 0 && u32_BatchCount <= (u32_BatchLength / us_RecordHeaderMin));
+    
+    try
+    {
+        if (b_Valid == true && (v_Queue.capacity() - us_QueueSize) < u32_BatchCount)
+        {
+            v_Queue.reserve(us_QueueSize + std::max(static_cast<size_t>(u32_BatchCount), us_ReserveStep));
+        }
+        
+        MRH_Uint32 u32_GroupID;
+        MRH_Uint32 u32_Type;
+        MRH_Uint32 u32_DataSize;
+        
+        for (MRH_Uint32 i = 0; b_Valid == true && i < u32_BatchCount; ++i)
+        {
+            if (static_cast<size_t>(p_End - p_Record) < us_RecordHeaderMin)
+            {
+                b_Valid = false;
+                break;
             }
-            b_NextData = CheckNextData((u32_DataSize == 0 ? TransmissionData::FINISHED : TransmissionData::DATA), sizeof(u32_DataSize));
-            break;
             
-        case TransmissionData::DATA:
-            Read(v_Data.data(), u32_DataSize);
-            b_NextData = CheckNextData(TransmissionData::FINISHED, u32_DataSize);
-            break;
+            std::memcpy(&u32_GroupID, p_Record, sizeof(MRH_Uint32));
+            p_Record += sizeof(MRH_Uint32);
             
-        case TransmissionData::FINISHED:
-            // Grow if needed
-            if (v_Queue.size() == v_Queue.capacity())
+            if (ReadVarint(p_Record, p_End, u32_Type) == false ||
+                ReadVarint(p_Record, p_End, u32_DataSize) == false ||
+                u32_DataSize > static_cast<size_t>(p_End - p_Record))
             {
-                v_Queue.reserve(v_Queue.capacity() + us_ReserveStep);
+                b_Valid = false;
+                break;
             }
             
-            // Event constructor only uses the buffer up to u32_DataSize,
-            // allowing us to skip removing old garbage data
             v_Queue.emplace_back(u32_GroupID,
                                  u32_Type,
-                                 v_Data.data(),
+                                 p_Record,
                                  u32_DataSize);
-            e_Data = TransmissionData::GROUP_ID;
-            b_NextData = true;
-            break;
-            
-        default:
-            b_NextData = false;
-            break;
+            p_Record += u32_DataSize;
+        }
     }
+    catch (...)
+    {
+        // Keep the batch buffered to retry
+        v_Queue.erase(v_Queue.begin() + us_QueueSize, v_Queue.end());
+        return TransmissionState::FAILED;
+    }
+    
+    us_BufferStart += us_BatchSize;
+    b_PeerBatched = true;
     
-    // State change failed or other issues
-    if (b_NextData == false)
+    if (u32_BatchSequence != u32_Sequence)
     {
+        Logger::Singleton().Log(Logger::WARNING, "Event batch sequence mismatch: Expected " +
+                                                 std::to_string(u32_Sequence) +
+                                                 ", got " +
+                                                 std::to_string(u32_BatchSequence) +
+                                                 "!",
+                                "EventQueue.cpp", __LINE__);
+    }
+    
+    u32_Sequence = u32_BatchSequence + 1;
+    
+    if (b_Valid == false || p_Record != p_End)
+    {
+        // Malformed batch, drop it completely
+        v_Queue.erase(v_Queue.begin() + us_QueueSize, v_Queue.end());
+        Logger::Singleton().Log(Logger::WARNING, "Dropped malformed event batch " +
+                                                 std::to_string(u32_BatchSequence) +
+                                                 "!",
+                                "EventQueue.cpp", __LINE__);
         return TransmissionState::FAILED;
     }
     
-    // Did we just reach finished? We recieved a complete event if so
-    return (e_Data == TransmissionData::FINISHED ? TransmissionState::COMPLETED : TransmissionState::CONTINUE);
+    return TransmissionState::COMPLETED;
+}
+
+bool EventQueue::Queue::GetBufferFull() const noexcept
+{
+    return us_BufferEnd == v_Buffer.size();
+}
+
+bool EventQueue::Queue::GetBufferPending() const noexcept
+{
+    size_t us_Available = us_BufferEnd - us_BufferStart;
+    
+    if (us_Available < us_FrameHeaderSize)
+    {
+        return false;
+    }
+    
+    const MRH_Uint8* p_Frame = &(v_Buffer[us_BufferStart]);
+    MRH_Uint32 u32_FrameGroupID;
+    MRH_Uint32 u32_FrameDataSize;
+    
+    std::memcpy(&u32_FrameGroupID, p_Frame, sizeof(MRH_Uint32));
+    
+    if (b_Batched == true && u32_FrameGroupID == u32_BatchMagic)
+    {
+        if (us_Available < us_BatchHeaderSize)
+        {
+            return false;
+        }
+        
+        std::memcpy(&u32_FrameDataSize, p_Frame + (sizeof(MRH_Uint32) * 2), sizeof(MRH_Uint32));
+        return us_Available >= (us_BatchHeaderSize + u32_FrameDataSize);
+    }
+    
+    std::memcpy(&u32_FrameDataSize, p_Frame + (sizeof(MRH_Uint32) * 2), sizeof(MRH_Uint32));
+    return us_Available >= (us_FrameHeaderSize + u32_FrameDataSize);
 }
 
-#if MRH_CORE_EVENT_LOGGING > 0
 void EventQueue::LogRecievedEvents(Event const& c_Event) noexcept
 {
-    EventLogger::Singleton().Log(c_Event, "Default event queue recieved logger.");
+    EventLogger::Singleton().Log(c_Event, EventLogFormat::RECIEVED, EventLogFormat::QUEUE, 0);
 }
-#endif
 
 void EventQueue::RecieveEvents(MRH_Uint32 u32_EventLimit, MRH_Sint32 s32_TimeoutMS) noexcept
 {
+    Queue& c_Queue = p_Queue[C_W_P_R];
+    
+    // The child accepted the batch offer once it sent a batch itself
+    if (c_Queue.b_PeerBatched == true && u32_SendWireVersion.load(std::memory_order_relaxed) == 1)
+    {
+        u32_SendWireVersion.store(2, std::memory_order_relaxed);
+    }
+    
     // Clear last recieved
-    p_Queue[C_W_P_R].v_Queue.clear();
+    c_Queue.v_Queue.clear();
     
-    // Recieve until read fails or limit reached
-    if (p_Queue[C_W_P_R].p_Source->CanRead(s32_TimeoutMS) == true)
+    // Recieve buffered events first, refill the buffer once exhausted
+    // @NOTE: A single read drains the source completely unless the buffer
+    //        was filled, only then is another read required
+    MRH_Uint32 u32_Recieved = 0;
+    size_t us_ReserveStep = u32_EventLimit; // EventLimit 0 -> No loop -> not required to check step = 0
+    bool b_Refill = true;
+    bool b_Waited = false;
+    bool b_Log = EventLogger::GetEnabled(); // Checked once per recieve
+    
+    while (u32_Recieved < u32_EventLimit)
     {
-        MRH_Uint32 u32_Recieved = 0;
-        size_t us_ReserveStep = u32_EventLimit; // EventLimit 0 -> No loop -> not required to check step = 0
-        
-        while (u32_Recieved < u32_EventLimit)
+        switch (c_Queue.RecieveEvent(us_ReserveStep))
         {
-            switch (p_Queue[C_W_P_R].RecieveEvent(us_ReserveStep))
-            {
-                case Queue::TransmissionState::COMPLETED: // Add recieved count for limit
-#if MRH_CORE_EVENT_LOGGING > 0
-                    LogRecievedEvents(p_Queue[C_W_P_R].GetLastProccessedEvent());
+            case Queue::TransmissionState::COMPLETED: // Add recieved count for limit, batches add all events
+                if (b_Log == true)
+                {
+                    for (size_t i = u32_Recieved; i < c_Queue.v_Queue.size(); ++i)
+                    {
+                        LogRecievedEvents(c_Queue.v_Queue[i]);
+                    }
+                }
+#if MRH_CORE_EVENT_TRACING > 0
+                for (size_t i = u32_Recieved; i < c_Queue.v_Queue.size(); ++i)
+                {
+                    EventTrace::Singleton().Ingress(c_Queue.v_Queue[i], u32_TraceEndpoint);
+                }
 #endif
-                    ++u32_Recieved;
-                case Queue::TransmissionState::CONTINUE: // Keep loop alive
-                    break;
-                    
-                default: // Failure, stop loop
+                u32_Recieved = static_cast<MRH_Uint32>(c_Queue.v_Queue.size());
+                break;
+            
+            case Queue::TransmissionState::CONTINUE: // Buffer exhausted, refill
+                if (b_Refill == false)
+                {
                     return;
-            }
+                }
+                else if (c_Queue.FillBuffer() > 0)
+                {
+                    b_Refill = c_Queue.GetBufferFull();
+                }
+                else if (b_Waited == true || u32_Recieved > 0 || c_Queue.p_Source->CanRead(s32_TimeoutMS) == false)
+                {
+                    // Nothing to read, only wait for new data if nothing was recieved yet
+                    return;
+                }
+                else
+                {
+                    b_Waited = true;
+                }
+                break;
+            
+            default: // Failure, stop loop
+                return;
         }
     }
 }
@@ -272,97 +639,216 @@ std::vector<Event>& EventQueue::RetrieveEvents() noexcept
     return p_Queue[C_W_P_R].v_Queue;
 }
 
+bool EventQueue::PrepareRecievePoll() noexcept
+{
+    // Buffered data is not seen by the source
+    if (p_Queue[C_W_P_R].GetBufferPending() == true)
+    {
+        return false;
+    }
+    
+    return p_Queue[C_W_P_R].p_Source->PrepareReadPoll();
+}
+
 //*************************************************************************************
 // Send
 //*************************************************************************************
 
-void EventQueue::Queue::Write(const MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept
+bool EventQueue::Queue::CreateBatch(MRH_Uint32 u32_EventLimit, MRH_Uint32 u32_WireVersion) noexcept
 {
-    ssize_t ss_Write;
+    size_t us_Pending = v_Queue.size() - us_QueueHead;
+    MRH_Uint32 u32_Size = (us_Pending < u32_EventLimit ? static_cast<MRH_Uint32>(us_Pending) : u32_EventLimit);
     
-    if ((ss_Write = p_Source->Write(&(p_Data[u32_BytesProcessed]), u32_Length - u32_BytesProcessed)) > 0)
+    if (u32_Size == 0)
     {
-        u32_BytesProcessed += ss_Write;
+        return false;
     }
+    
+    // Batches add the batch header as the first buffer
+    us_VectorBase = (u32_WireVersion > 1 ? 1 : 0);
+    
+    // Header and buffer storage stays allocated between batches
+    try
+    {
+        if (us_VectorBase > 0)
+        {
+            v_Header.resize(us_BatchHeaderSize + (u32_Size * us_RecordHeaderMax));
+        }
+        else
+        {
+            v_Header.resize(u32_Size * us_FrameHeaderSize);
+        }
+        
+        v_Vector.resize(us_VectorBase + (u32_Size * 2));
+    }
+    catch (...)
+    {
+        return false;
+    }
+    
+    MRH_Uint8* p_Header = v_Header.data() + (us_VectorBase > 0 ? us_BatchHeaderSize : 0);
+    struct iovec* p_Vector = v_Vector.data() + us_VectorBase;
+    MRH_Uint32 u32_Length = 0;
+    
+    for (MRH_Uint32 i = 0; i < u32_Size; ++i)
+    {
+        Event& c_Event = v_Queue[us_QueueHead + i];
+        MRH_Uint32 u32_GroupID = c_Event.GetGroupID();
+        MRH_Uint32 u32_Type = c_Event.GetType();
+        MRH_Uint32 u32_DataSize = c_Event.GetDataSize();
+        
+        // Keep batches below the length a reader accepts
+        if (us_VectorBase > 0 && i > 0 && (u32_Length + us_RecordHeaderMax + u32_DataSize) > us_BatchLengthMax)
+        {
+            u32_Size = i;
+            v_Vector.resize(us_VectorBase + (u32_Size * 2));
+            break;
+        }
+        
+        p_Vector[0].iov_base = p_Header;
+        std::memcpy(p_Header, &u32_GroupID, sizeof(MRH_Uint32));
+        
+        if (us_VectorBase > 0)
+        {
+            p_Header = WriteVarint(p_Header + sizeof(MRH_Uint32), u32_Type);
+            p_Header = WriteVarint(p_Header, u32_DataSize);
+        }
+        else
+        {
+            std::memcpy(p_Header + sizeof(MRH_Uint32), &u32_Type, sizeof(MRH_Uint32));
+            std::memcpy(p_Header + (sizeof(MRH_Uint32) * 2), &u32_DataSize, sizeof(MRH_Uint32));
+            p_Header += us_FrameHeaderSize;
+        }
+        
+        // Data is written directly from the event, the queue keeps it alive
+        p_Vector[0].iov_len = p_Header - static_cast<MRH_Uint8*>(p_Vector[0].iov_base);
+        p_Vector[1].iov_base = const_cast<MRH_Uint8*>(c_Event.GetData());
+        p_Vector[1].iov_len = (p_Vector[1].iov_base != NULL ? u32_DataSize : 0);
+        
+        u32_Length += p_Vector[0].iov_len + p_Vector[1].iov_len;
+        p_Vector += 2;
+    }
+    
+    if (us_VectorBase > 0)
+    {
+        MRH_Uint32 p_BatchHeader[4] = { u32_BatchMagic, u32_Size, u32_Length, u32_Sequence++ };
+        
+        std::memcpy(v_Header.data(), p_BatchHeader, us_BatchHeaderSize);
+        v_Vector[0].iov_base = v_Header.data();
+        v_Vector[0].iov_len = us_BatchHeaderSize;
+    }
+    
+    us_VectorPos = 0;
+    u32_BatchSize = u32_Size;
+    u32_BatchSent = 0;
+    
+    return true;
 }
 
-EventQueue::Queue::TransmissionState EventQueue::Queue::SendEvent() noexcept
+EventQueue::Queue::TransmissionState EventQueue::Queue::SendBatch(MRH_Uint32 u32_EventLimit, MRH_Uint32 u32_WireVersion) noexcept
 {
-    bool b_NextData;
-    
-    switch (e_Data)
+    // Create a new batch if none is in progress
+    if (u32_BatchSize == 0)
     {
-        case TransmissionData::GROUP_ID:
-            Write((const MRH_Uint8*)(&u32_GroupID), sizeof(u32_GroupID));
-            b_NextData = CheckNextData(TransmissionData::TYPE, sizeof(u32_GroupID));
-            break;
+        if (CreateBatch(u32_EventLimit, u32_WireVersion) == false)
+        {
+            return TransmissionState::FAILED;
+        }
+    }
+    else
+    {
+        // Inline event data moves with the event if the queue grew,
+        // point the remaining data buffers to the current location
+        size_t us_Completed = (us_VectorPos > us_VectorBase ? us_VectorPos - us_VectorBase : 0);
+        
+        for (size_t i = us_VectorBase + 1 + (us_Completed & ~static_cast<size_t>(1)); i < v_Vector.size(); i += 2)
+        {
+            Event& c_Event = v_Queue[us_QueueHead + ((i - us_VectorBase) / 2)];
+            struct iovec& c_Vector = v_Vector[i];
             
-        case TransmissionData::TYPE:
-            Write((const MRH_Uint8*)(&u32_Type), sizeof(u32_Type));
-            b_NextData = CheckNextData(TransmissionData::DATA_SIZE, sizeof(u32_Type));
-            break;
-                
-        case TransmissionData::DATA_SIZE:
-            Write((const MRH_Uint8*)(&u32_DataSize), sizeof(u32_DataSize));
-            b_NextData = CheckNextData((u32_DataSize == 0 ? TransmissionData::FINISHED : TransmissionData::DATA), sizeof(u32_DataSize));
-            break;
-                    
-        case TransmissionData::DATA:
-            Write(v_Data.data(), u32_DataSize);
-            b_NextData = CheckNextData(TransmissionData::FINISHED, u32_DataSize);
+            if (c_Vector.iov_len > 0)
+            {
+                c_Vector.iov_base = const_cast<MRH_Uint8*>(c_Event.GetData()) + (c_Event.GetDataSize() - c_Vector.iov_len);
+            }
+        }
+    }
+    
+    size_t us_VectorCount = v_Vector.size();
+    bool b_Sent = false;
+    ssize_t ss_Write;
+    
+    while (us_VectorPos < us_VectorCount)
+    {
+        if ((ss_Write = p_Source->Write(&(v_Vector[us_VectorPos]), us_VectorCount - us_VectorPos)) <= 0)
+        {
             break;
+        }
+        
+        size_t us_Written = static_cast<size_t>(ss_Write);
+        b_Sent = true;
+        
+        // Move resume point past all written buffers
+        while (us_VectorPos < us_VectorCount)
+        {
+            struct iovec& c_Vector = v_Vector[us_VectorPos];
             
-        case TransmissionData::FINISHED:
-            if (v_Queue.size() > 0)
+            if (us_Written < c_Vector.iov_len)
             {
-                u32_GroupID = v_Queue[0].GetGroupID();
-                u32_Type = v_Queue[0].GetType();
-                
-                // Skip data copy on empty
-                if ((u32_DataSize = v_Queue[0].GetDataSize()) > 0)
-                {
-                    // Only add missing space, all old stuff is overwritten anyway
-                    // The buffer is only written up to DataSize, skipping old garbage data
-                    if (v_Data.size() < u32_DataSize)
-                    {
-                        v_Data.insert(v_Data.end(), u32_DataSize - v_Data.size(), 0);
-                    }
-                    
-                    std::memcpy(v_Data.data(), v_Queue[0].GetData(), u32_DataSize);
-                }
-                
-                v_Queue.erase(v_Queue.begin());
-            
-                e_Data = TransmissionData::GROUP_ID;
-                b_NextData = true;
+                c_Vector.iov_base = static_cast<MRH_Uint8*>(c_Vector.iov_base) + us_Written;
+                c_Vector.iov_len -= us_Written;
+                break;
             }
-            else
+            
+            us_Written -= c_Vector.iov_len;
+            c_Vector.iov_len = 0;
+            
+            // Data buffer done, event completed
+            if (++us_VectorPos > us_VectorBase && ((us_VectorPos - us_VectorBase) % 2) == 0)
             {
-                b_NextData = false;
+                ++u32_BatchSent;
             }
-            break;
-            
-        default:
-            b_NextData = false;
-            break;
+        }
     }
     
-    // State change failed or other issues
-    if (b_NextData == false)
+    if (u32_BatchSent == u32_BatchSize)
     {
-        return TransmissionState::FAILED;
+        return TransmissionState::COMPLETED;
     }
     
-    // Did we just reach finished? We recieved a complete event if so
-    return (e_Data == TransmissionData::FINISHED ? TransmissionState::COMPLETED : TransmissionState::CONTINUE);
+    return (b_Sent == true ? TransmissionState::CONTINUE : TransmissionState::FAILED);
+}
+
+void EventQueue::Queue::RemoveBatch() noexcept
+{
+    if (u32_BatchSize == 0)
+    {
+        return;
+    }
+    
+    us_QueueHead += u32_BatchSize;
+    
+    // Release sent events in one go, keeps draining linear
+    if (us_QueueHead == v_Queue.size())
+    {
+        v_Queue.clear();
+        us_QueueHead = 0;
+    }
+    else if (us_QueueHead >= (v_Queue.size() - us_QueueHead))
+    {
+        v_Queue.erase(v_Queue.begin(), v_Queue.begin() + us_QueueHead);
+        us_QueueHead = 0;
+    }
+    
+    us_VectorBase = 0;
+    us_VectorPos = 0;
+    u32_BatchSize = 0;
+    u32_BatchSent = 0;
 }
 
-#if MRH_CORE_EVENT_LOGGING > 0
 void EventQueue::LogSentEvents(Event const& c_Event) noexcept
 {
-    EventLogger::Singleton().Log(c_Event, "Default event queue sent logger.");
+    EventLogger::Singleton().Log(c_Event, EventLogFormat::SENT, EventLogFormat::QUEUE, 0);
 }
-#endif
 
 void EventQueue::AddSendEvents(std::vector<Event>& v_Event) noexcept
 {
@@ -371,29 +857,192 @@ void EventQueue::AddSendEvents(std::vector<Event>& v_Event) noexcept
         return;
     }
     
-    // Move given events to our send queue
-    std::move(v_Event.begin(), v_Event.end(), std::back_inserter(p_Queue[P_W_C_R].v_Queue));
+    EventLane& c_EventLane = EventLane::Singleton();
+    MRH_Uint64 u64_TimeUS = EventLane::GetTimeUS();
+    size_t us_Added = 0;
+    
+    // Move given events to their lane
+    for (size_t i = 0; i < v_Event.size(); ++i)
+    {
+#if MRH_CORE_EVENT_TRACING > 0
+        EventTrace::Singleton().Record(EventTrace::QUEUE, v_Event[i], u32_TraceEndpoint);
+#endif
+        Lane& c_Lane = p_Lane[c_EventLane.GetLane(v_Event[i].GetType())];
+        bool b_Added = false;
+        
+        try
+        {
+            c_Lane.v_Event.emplace_back(std::move(v_Event[i]));
+            b_Added = true;
+            c_Lane.v_TimeUS.push_back(u64_TimeUS);
+            ++us_Added;
+        }
+        catch (std::exception& e)
+        {
+            // Keep event and time vector in step
+            if (b_Added == true)
+            {
+                c_Lane.v_Event.pop_back();
+            }
+            
+            Logger::Singleton().Log(Logger::WARNING, "Failed to add send event: " + std::string(e.what()),
+                                    "EventQueue.cpp", __LINE__);
+        }
+    }
+    
+    us_SendDepth.fetch_add(us_Added, std::memory_order_relaxed);
     v_Event.clear();
 }
 
+void EventQueue::StageSendEvents(size_t us_Count) noexcept
+{
+    std::vector<Event>& v_Queue = p_Queue[P_W_C_R].v_Queue;
+    MRH_Uint64 u64_TimeUS = EventLane::GetTimeUS();
+    MRH_Uint64 p_Count[EventLane::LANE_COUNT] = { 0 };
+    MRH_Uint64 p_WaitUS[EventLane::LANE_COUNT] = { 0 };
+    MRH_Uint64 p_MaxUS[EventLane::LANE_COUNT] = { 0 };
+    size_t us_Lane;
+    size_t i;
+    
+    for (; us_Count > 0; --us_Count)
+    {
+        // Highest lane with events first
+        for (us_Lane = 0; us_Lane < EventLane::LANE_COUNT; ++us_Lane)
+        {
+            if (p_Lane[us_Lane].us_Head < p_Lane[us_Lane].v_Event.size())
+            {
+                break;
+            }
+        }
+        
+        if (us_Lane == EventLane::LANE_COUNT)
+        {
+            break;
+        }
+        
+        // Lower lanes waited for this one, hand a starving lane a event instead
+        for (i = us_Lane + 1; i < EventLane::LANE_COUNT; ++i)
+        {
+            if (p_Lane[i].us_Head < p_Lane[i].v_Event.size())
+            {
+                if (p_Lane[i].u32_Skipped >= u32_LaneStarvationLimit)
+                {
+                    us_Lane = i;
+                    break;
+                }
+                
+                ++(p_Lane[i].u32_Skipped);
+            }
+        }
+        
+        Lane& c_Lane = p_Lane[us_Lane];
+        MRH_Uint64 u64_WaitUS = u64_TimeUS - c_Lane.v_TimeUS[c_Lane.us_Head];
+        
+        try
+        {
+            v_Queue.emplace_back(std::move(c_Lane.v_Event[c_Lane.us_Head]));
+        }
+        catch (std::exception& e)
+        {
+            // Keep the event in the lane, stage again later
+            break;
+        }
+        
+        ++(c_Lane.us_Head);
+        c_Lane.u32_Skipped = 0;
+        
+        ++(p_Count[us_Lane]);
+        p_WaitUS[us_Lane] += u64_WaitUS;
+        p_MaxUS[us_Lane] = std::max(p_MaxUS[us_Lane], u64_WaitUS);
+    }
+    
+    EventLane& c_EventLane = EventLane::Singleton();
+    
+    for (i = 0; i < EventLane::LANE_COUNT; ++i)
+    {
+        if (p_Count[i] == 0)
+        {
+            continue;
+        }
+        
+        c_EventLane.AddWait(static_cast<EventLane::Lane>(i), p_Count[i], p_WaitUS[i], p_MaxUS[i]);
+        
+        // Release staged events in one go, same as the send queue
+        Lane& c_Lane = p_Lane[i];
+        
+        if (c_Lane.us_Head == c_Lane.v_Event.size())
+        {
+            c_Lane.v_Event.clear();
+            c_Lane.v_TimeUS.clear();
+            c_Lane.us_Head = 0;
+        }
+        else if (c_Lane.us_Head >= (c_Lane.v_Event.size() - c_Lane.us_Head))
+        {
+            c_Lane.v_Event.erase(c_Lane.v_Event.begin(), c_Lane.v_Event.begin() + c_Lane.us_Head);
+            c_Lane.v_TimeUS.erase(c_Lane.v_TimeUS.begin(), c_Lane.v_TimeUS.begin() + c_Lane.us_Head);
+            c_Lane.us_Head = 0;
+        }
+    }
+}
+
 void EventQueue::SendEvents(MRH_Uint32 u32_EventLimit) noexcept
 {
-    // Send until write fails or limit reached
+    Queue& c_Queue = p_Queue[P_W_C_R];
+    
+    // Send batches until write fails or limit reached
+    // @NOTE: A partially sent batch is always completed first, which
+    //        might exceed the limit given for this call
     MRH_Uint32 u32_Sent = 0;
+    MRH_Uint32 u32_BatchLimit;
+    MRH_Uint32 u32_BatchSent;
+    MRH_Uint32 u32_Completed;
+    Queue::TransmissionState e_State;
+    bool b_Log = EventLogger::GetEnabled(); // Checked once per send
     
     while (u32_Sent < u32_EventLimit)
     {
-        switch (p_Queue[P_W_C_R].SendEvent())
+        u32_BatchLimit = u32_EventLimit - u32_Sent;
+        
+        if (c_Queue.u32_BatchLimit > 0 && c_Queue.u32_BatchLimit < u32_BatchLimit)
         {
-            case Queue::TransmissionState::COMPLETED: // Add send count for limit
-#if MRH_CORE_EVENT_LOGGING > 0
-                LogSentEvents(Event(p_Queue[P_W_C_R].GetLastProccessedEvent()));
+            u32_BatchLimit = c_Queue.u32_BatchLimit;
+        }
+        
+        // Stage only what the next batch takes, lanes decide the order
+        if (c_Queue.GetQueued() < u32_BatchLimit)
+        {
+            StageSendEvents(u32_BatchLimit - c_Queue.GetQueued());
+        }
+        
+        u32_BatchSent = c_Queue.GetBatchSent();
+        e_State = c_Queue.SendBatch(u32_BatchLimit, u32_SendWireVersion.load(std::memory_order_relaxed));
+        
+        if (b_Log == true)
+        {
+            for (MRH_Uint32 i = u32_BatchSent; i < c_Queue.GetBatchSent(); ++i)
+            {
+                LogSentEvents(c_Queue.GetBatchEvent(i));
+            }
+        }
+#if MRH_CORE_EVENT_TRACING > 0
+        for (MRH_Uint32 i = u32_BatchSent; i < c_Queue.GetBatchSent(); ++i)
+        {
+            EventTrace::Singleton().Record(EventTrace::SEND, c_Queue.GetBatchEvent(i), u32_TraceEndpoint);
+        }
 #endif
-                ++u32_Sent;
-            case Queue::TransmissionState::CONTINUE: // Keep loop alive
+        u32_Completed = c_Queue.GetBatchSent() - u32_BatchSent;
+        u32_Sent += u32_Completed;
+        
+        us_SendDepth.fetch_sub(u32_Completed, std::memory_order_relaxed);
+        u64_SendDrained.fetch_add(u32_Completed, std::memory_order_relaxed);
+        
+        switch (e_State)
+        {
+            case Queue::TransmissionState::COMPLETED: // Batch done, continue with next
+                c_Queue.RemoveBatch();
                 break;
                 
-            default: // Failure, stop loop
+            default: // Source full or failure, stop loop
                 return;
         }
     }
@@ -405,19 +1054,50 @@ void EventQueue::SendEvents(std::vector<Event>& v_Event, MRH_Uint32 u32_EventLim
     SendEvents(u32_EventLimit);
 }
 
+//*************************************************************************************
+// Statistics
+//*************************************************************************************
+
+void EventQueue::LogStatistics(std::string const& s_Name) noexcept
+{
+    auto c_Now = std::chrono::steady_clock::now();
+    double f64_Seconds = std::chrono::duration<double>(c_Now - c_LastStatistics).count();
+    c_LastStatistics = c_Now;
+    
+    MRH_Uint64 u64_Drained = u64_SendDrained.load(std::memory_order_relaxed);
+    MRH_Uint64 u64_New = u64_Drained - u64_LastDrained;
+    u64_LastDrained = u64_Drained;
+    
+    Logger::Singleton().Log(Logger::INFO, "Event queue " +
+                                          s_Name +
+                                          ": Send depth " +
+                                          std::to_string(us_SendDepth.load(std::memory_order_relaxed)) +
+                                          ", Drained " +
+                                          std::to_string(u64_Drained) +
+                                          " events (" +
+                                          std::to_string(f64_Seconds > 0.0 ? static_cast<MRH_Uint64>(u64_New / f64_Seconds) : 0) +
+                                          "/s)",
+                            "EventQueue.cpp", __LINE__);
+}
+
 //*************************************************************************************
 // Getters
 //*************************************************************************************
 
-#if MRH_CORE_EVENT_LOGGING > 0
-Event EventQueue::Queue::GetLastProccessedEvent() noexcept
+MRH_Uint32 EventQueue::Queue::GetBatchSent() const noexcept
 {
-    return Event(u32_GroupID,
-                 u32_Type,
-                 v_Data.data(),
-                 u32_DataSize);
+    return u32_BatchSent;
+}
+
+Event const& EventQueue::Queue::GetBatchEvent(MRH_Uint32 u32_Event) const noexcept
+{
+    return v_Queue[us_QueueHead + u32_Event];
+}
+
+size_t EventQueue::Queue::GetQueued() const noexcept
+{
+    return v_Queue.size() - us_QueueHead;
 }
-#endif
 
 int EventQueue::GetPipeFD(QueueType e_Queue, SourcePipe::PipeEnd e_End) const
 {
@@ -440,3 +1120,74 @@ int EventQueue::GetPipeFD(QueueType e_Queue, SourcePipe::PipeEnd e_End) const
     
     throw EventException("Invalid event queue pipe end requested!");
 }
+
+std::string EventQueue::GetSourceArgument(QueueType e_Queue) const
+{
+    if (e_Queue >= QueueType::QUEUE_COUNT)
+    {
+        throw EventException("Invalid event queue source requested!");
+    }
+    
+    switch (p_Queue[e_Queue].p_Source->GetType())
+    {
+        case TransmissionSource::PIPE:
+            // Child reads P_W_C_R and writes C_W_P_R
+            return std::to_string(GetPipeFD(e_Queue, (e_Queue == P_W_C_R ? SourcePipe::PIPE_END_READ : SourcePipe::PIPE_END_WRITE)));
+        
+        case TransmissionSource::SHARED_MEMORY:
+        {
+            SourceSharedMemory* p_Source = p_Queue[e_Queue].GetSource<SourceSharedMemory*>();
+            return std::to_string(p_Source->GetMemoryFD()) + ":" + std::to_string(p_Source->GetNotifyFD());
+        }
+        
+        default:
+            throw EventException("Event queue source has no launch argument!");
+    }
+}
+
+std::string EventQueue::GetTransportInfo() const
+{
+    MRH_Uint32 u32_BatchLimit = p_Queue[P_W_C_R].u32_BatchLimit;
+    
+    return "capacity " +
+           std::to_string(p_Queue[P_W_C_R].p_Source->GetCapacity()) +
+           " / " +
+           std::to_string(p_Queue[C_W_P_R].p_Source->GetCapacity()) +
+           " bytes, read batch " +
+           std::to_string(p_Queue[C_W_P_R].us_BufferSize) +
+           " bytes, write batch " +
+           (u32_BatchLimit > 0 ? std::to_string(u32_BatchLimit) + " events" : "event limit") +
+           ", wire format " +
+           std::to_string(GetWireVersion()) +
+           (p_Queue[C_W_P_R].b_Batched == true ? " offered" : "");
+}
+
+MRH_Uint32 EventQueue::GetWireVersion() const noexcept
+{
+    return (p_Queue[C_W_P_R].b_Batched == true ? 2 : 1);
+}
+
+size_t EventQueue::GetSendQueueDepth() const noexcept
+{
+    return us_SendDepth.load(std::memory_order_relaxed);
+}
+
+MRH_Uint64 EventQueue::GetSendQueueDrained() const noexcept
+{
+    return u64_SendDrained.load(std::memory_order_relaxed);
+}
+
+bool EventQueue::GetFailed() const noexcept
+{
+    return p_Queue[C_W_P_R].b_Failed == true || p_Queue[C_W_P_R].p_Source->GetFailed() == true || p_Queue[P_W_C_R].p_Source->GetFailed() == true;
+}
+
+int EventQueue::GetRecievePollFD() const noexcept
+{
+    return p_Queue[C_W_P_R].p_Source->GetReadPollFD();
+}
+
+int EventQueue::GetSendPollFD() const noexcept
+{
+    return p_Queue[P_W_C_R].p_Source->GetWritePollFD();
+}
@@ -18,6 +18,8 @@
 #define EventQueue_h
 
 // C / C++
+#include <atomic>
+#include <chrono>
 
 // External
 
@@ -26,13 +28,11 @@
 #include "./Source/SourceMRHCKM.h"
 #endif
 #include "./Source/SourcePipe.h"
+#include "./Source/SourceSharedMemory.h"
+#include "./EventLane.h"
+#include "./EventTrace.h"
 #include "./Event.h"
 
-// Pre-defined
-#ifndef MRH_CORE_EVENT_LOGGING
-    #define MRH_CORE_EVENT_LOGGING 0
-#endif
-
 
 class EventQueue
 {
@@ -114,40 +114,114 @@ private:
         //*************************************************************************************
         
         /**
-         *  Recieve the current event.
+         *  Recieve the next complete event from the recieve buffer.
          *
          *  \param us_ReserveStep The reserve step size for growing the event vector.
          *
-         *  \return The current queue update state.
+         *  \return COMPLETED if a event was recieved, CONTINUE if more data is required,
+         *          FAILED if the event could not be recieved.
          */
         
         TransmissionState RecieveEvent(size_t const& us_ReserveStep) noexcept;
         
+        /**
+         *  Recieve all events of the next complete v2 batch from the recieve buffer.
+         *
+         *  \param us_ReserveStep The reserve step size for growing the event vector.
+         *
+         *  \return COMPLETED if the batch was recieved, CONTINUE if more data is required,
+         *          FAILED if the batch could not be recieved.
+         */
+        
+        TransmissionState RecieveBatch(size_t const& us_ReserveStep) noexcept;
+        
+        /**
+         *  Close the source after malformed data was recieved.
+         *
+         *  \param s_Reason The reason logged for closing.
+         *
+         *  \return Always FAILED.
+         */
+        
+        TransmissionState CloseMalformed(std::string const& s_Reason) noexcept;
+        
+        /**
+         *  Fill the recieve buffer with all data currently available from the source.
+         *
+         *  \return The amount of bytes read on success, 0 or -1 if nothing was read.
+         */
+        
+        ssize_t FillBuffer() noexcept;
+        
+        /**
+         *  Check if the recieve buffer is completely filled.
+         *
+         *  \return true if the buffer has no space left, false if not.
+         */
+        
+        bool GetBufferFull() const noexcept;
+        
+        /**
+         *  Check if the recieve buffer contains a complete event.
+         *
+         *  \return true if a event can be recieved without reading, false if not.
+         */
+        
+        bool GetBufferPending() const noexcept;
+        
         //*************************************************************************************
         // Send
         //**************************************************************************************
         
         /**
-         *  Send the current event.
+         *  Send the current event batch. A new batch is created from the queue
+         *  if the previous batch was completed.
+         *
+         *  \param u32_EventLimit The max amount of events in a new batch.
+         *  \param u32_WireVersion The wire format version for a new batch.
          *
-         *  \return The current queue update state.
+         *  \return COMPLETED if the batch was sent, CONTINUE if the batch was sent
+         *          partially, FAILED if nothing was sent.
+         */
+        
+        TransmissionState SendBatch(MRH_Uint32 u32_EventLimit, MRH_Uint32 u32_WireVersion) noexcept;
+        
+        /**
+         *  Remove the completed event batch from the queue. Sent events are
+         *  released together once they make up half of the queue.
          */
         
-        TransmissionState SendEvent() noexcept;
+        void RemoveBatch() noexcept;
         
         //*************************************************************************************
         // Getters
         //*************************************************************************************
         
         /**
-         *  Return the last worked on event.
+         *  Get the amount of completely sent events in the current batch.
          *
-         *  \return The last worked on event.
+         *  \return The sent event count.
          */
         
-#if MRH_CORE_EVENT_LOGGING > 0
-        Event GetLastProccessedEvent() noexcept;
-#endif
+        MRH_Uint32 GetBatchSent() const noexcept;
+        
+        /**
+         *  Get a event of the current batch.
+         *
+         *  \param u32_Event The event index in the batch.
+         *
+         *  \return The batch event.
+         */
+        
+        Event const& GetBatchEvent(MRH_Uint32 u32_Event) const noexcept;
+        
+        /**
+         *  Get the amount of queued events not yet completely sent.
+         *
+         *  \return The queued event count.
+         */
+        
+        size_t GetQueued() const noexcept;
         
         /**
          *  Get the queue source.
@@ -170,88 +244,110 @@ private:
         // Event
         std::vector<Event> v_Queue;
         
-    private:
-        
-        //*************************************************************************************
-        // Types
-        //*************************************************************************************
-        
-        typedef enum
-        {
-            GROUP_ID = 0,
-            TYPE = 1,
-            DATA_SIZE = 2,
-            DATA = 3,
-            FINISHED = 4,
-            
-            TRANSMISSION_DATA_MAX = FINISHED,
-            
-            TRANSMISSION_DATA_COUNT = TRANSMISSION_DATA_MAX + 1
-            
-        }TransmissionData;
-        
-        //*************************************************************************************
-        // Update
-        //*************************************************************************************
-        
-        /**
-         *  Check and update the transmission state.
-         *
-         *  \param e_NextData The next transmission data.
-         *  \param u32_Required The required processed byte size.
-         *
-         *  \return true if the state was updated, false if not.
-         */
-        
-        bool CheckNextData(TransmissionData e_NextData, MRH_Uint32 u32_Required) noexcept;
+        // Transport, recieve buffer bytes and max events per send batch
+        size_t us_BufferSize;
+        MRH_Uint32 u32_BatchLimit;
         
-        //*************************************************************************************
-        // Recieve
-        //*************************************************************************************
+        // Wire format, v2 batches are accepted and numbered by sequence
+        bool b_Batched;
+        bool b_PeerBatched;
+        MRH_Uint32 u32_Sequence;
         
-        /**
-         *  Read data from source.
-         *
-         *  \param p_Data The buffer to read to.
-         *  \param u32_Length The length to read.
-         */
-        
-        inline void Read(MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept;
+        // Recieved data which can't be trusted closed the queue
+        bool b_Failed;
+    
+    private:
         
         //*************************************************************************************
         // Send
         //*************************************************************************************
         
         /**
-         *  Write data to source.
+         *  Create a new send batch from the queued events.
+         *
+         *  \param u32_EventLimit The max amount of events in the batch.
+         *  \param u32_WireVersion The wire format version of the batch.
          *
-         *  \param p_Data The buffer to write from.
-         *  \param u32_Length The length to write.
+         *  \return true if a batch was created, false if not.
          */
         
-        inline void Write(const MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept;
+        bool CreateBatch(MRH_Uint32 u32_EventLimit, MRH_Uint32 u32_WireVersion) noexcept;
         
         //*************************************************************************************
         // Data
         //*************************************************************************************
         
-        TransmissionData e_Data;
-        MRH_Uint32 u32_BytesProcessed;
-        
-        MRH_Uint32 u32_GroupID;
-        MRH_Uint32 u32_Type;
-        MRH_Uint32 u32_DataSize;
-        std::vector<MRH_Uint8> v_Data;
-        
+        // Send queue, events before the head were sent
+        size_t us_QueueHead;
+        
+        // Send batch, 2 buffers per event: Header, Data
+        // @NOTE: v2 batches start with the batch header buffer
+        std::vector<MRH_Uint8> v_Header;
+        std::vector<struct iovec> v_Vector;
+        size_t us_VectorBase;
+        size_t us_VectorPos;
+        MRH_Uint32 u32_BatchSize;
+        MRH_Uint32 u32_BatchSent;
+        
+        // Recieve buffer, [Start, End) holds unparsed data
+        std::vector<MRH_Uint8> v_Buffer;
+        size_t us_BufferStart;
+        size_t us_BufferEnd;
+    
     protected:
         
     };
     
+    //*************************************************************************************
+    // Lane
+    //*************************************************************************************
+    
+    struct Lane
+    {
+        // Events before the head were staged
+        std::vector<Event> v_Event;
+        std::vector<MRH_Uint64> v_TimeUS;
+        size_t us_Head;
+        
+        // Events staged from higher lanes while this lane waited
+        MRH_Uint32 u32_Skipped;
+    };
+    
+    //*************************************************************************************
+    // Send
+    //*************************************************************************************
+    
+    /**
+     *  Move lane events to the P_W_C_R queue. Higher lanes are staged first,
+     *  a starving lower lane is given a single event.
+     *
+     *  \param us_Count The max amount of events to stage.
+     */
+    
+    void StageSendEvents(size_t us_Count) noexcept;
+    
     //*************************************************************************************
     // Data
     //*************************************************************************************
 
     Queue p_Queue[QUEUE_COUNT];
+    
+    // Send lanes, staged into P_W_C_R by priority
+    Lane p_Lane[EventLane::LANE_COUNT];
+    
+    // Send statistics
+    std::atomic<size_t> us_SendDepth;
+    std::atomic<MRH_Uint64> u64_SendDrained;
+    MRH_Uint64 u64_LastDrained;
+    std::chrono::steady_clock::time_point c_LastStatistics;
+    
+    // Wire format used for new send batches
+    std::atomic<MRH_Uint32> u32_SendWireVersion;
+    
+#if MRH_CORE_EVENT_TRACING > 0
+    // Trace endpoint of the process
+    MRH_Uint32 u32_TraceEndpoint;
+#endif
 
 protected:
 
@@ -291,6 +387,39 @@ protected:
 
     void Reset();
     
+    //*************************************************************************************
+    // Transport
+    //*************************************************************************************
+    
+    /**
+     *  Set the transport settings. The settings are applied on the next reset.
+     *
+     *  \param us_Capacity The source capacity in bytes, 0 for the source default.
+     *  \param us_ReadBatchSize The recieve buffer size in bytes, 0 for the default.
+     *  \param u32_WriteBatchSize The max amount of events per send batch, 0 for no limit.
+     */
+    
+    void SetTransport(size_t us_Capacity, size_t us_ReadBatchSize, MRH_Uint32 u32_WriteBatchSize) noexcept;
+    
+    /**
+     *  Set the highest wire format version offered to the child. Batches
+     *  are only sent once the child sent a batch itself.
+     *
+     *  \param u32_WireVersion The wire format version, 2 to offer batches.
+     */
+    
+    void SetWireVersion(MRH_Uint32 u32_WireVersion) noexcept;
+    
+    /**
+     *  Set the trace endpoint for recieved and sent events.
+     *
+     *  \param s_Name The endpoint name.
+     */
+     
+#if MRH_CORE_EVENT_TRACING > 0
+    void SetTraceEndpoint(std::string const& s_Name) noexcept;
+#endif
+    
     //*************************************************************************************
     // Recieve
     //*************************************************************************************
@@ -301,9 +430,7 @@ protected:
      *  \param c_Event The event to log.
      */
     
-#if MRH_CORE_EVENT_LOGGING > 0
     virtual void LogRecievedEvents(Event const& c_Event) noexcept;
-#endif
     
     /**
      *  Recieve events. The events are read from C_W_P_R.
@@ -321,6 +448,15 @@ protected:
      */
     
     std::vector<Event>& RetrieveEvents() noexcept;
+    
+    /**
+     *  Prepare the C_W_P_R source for an external wait on the recieve poll
+     *  file descriptor.
+     *
+     *  \return true if the source can be waited on, false if events are already readable.
+     */
+    
+    bool PrepareRecievePoll() noexcept;
 
     //*************************************************************************************
     // Send
@@ -332,9 +468,7 @@ protected:
      *  \param c_Event The event to log.
      */
     
-#if MRH_CORE_EVENT_LOGGING > 0
     virtual void LogSentEvents(Event const& c_Event) noexcept;
-#endif
     
     /**
      *  Add new events to send.
@@ -360,6 +494,19 @@ protected:
      */
 
     void SendEvents(std::vector<Event>& v_Event, MRH_Uint32 u32_EventLimit) noexcept;
+    
+    //*************************************************************************************
+    // Statistics
+    //*************************************************************************************
+    
+    /**
+     *  Log the send queue depth and the drain rate since the last call. Only
+     *  a single thread should log the statistics of a event queue.
+     *
+     *  \param s_Name The event queue name used for logging.
+     */
+    
+    void LogStatistics(std::string const& s_Name) noexcept;
 
     //*************************************************************************************
     // Getters
@@ -375,6 +522,77 @@ protected:
      */
     
     int GetPipeFD(QueueType e_Queue, SourcePipe::PipeEnd e_End) const;
+    
+    /**
+     *  Get the amount of events waiting to be sent. This function is thread safe.
+     *
+     *  \return The send queue depth.
+     */
+    
+    size_t GetSendQueueDepth() const noexcept;
+    
+    /**
+     *  Get the total amount of events sent. This function is thread safe.
+     *
+     *  \return The sent event count.
+     */
+    
+    MRH_Uint64 GetSendQueueDrained() const noexcept;
+    
+    /**
+     *  Check if a event queue was closed because the child broke the
+     *  transmission.
+     *
+     *  \return true if the event queue failed, false if not.
+     */
+    
+    bool GetFailed() const noexcept;
+    
+    /**
+     *  Get the file descriptor which becomes readable once C_W_P_R events
+     *  can be recieved.
+     *
+     *  \return The file descriptor on success, -1 if not available.
+     */
+    
+    int GetRecievePollFD() const noexcept;
+    
+    /**
+     *  Get the file descriptor which becomes writable once P_W_C_R events
+     *  can be sent.
+     *
+     *  \return The file descriptor on success, -1 if not available.
+     */
+    
+    int GetSendPollFD() const noexcept;
+    
+    /**
+     *  Get the launch argument describing the child end of an event queue.
+     *  Pipes are given as the file descriptor, shared memory rings as
+     *  "<memory fd>:<notification fd>".
+     *
+     *  \param e_Queue The queue content request.
+     *
+     *  \return The event queue child end launch argument.
+     */
+    
+    std::string GetSourceArgument(QueueType e_Queue) const;
+    
+    /**
+     *  Get a description of the effective transport settings.
+     *
+     *  \return The transport description.
+     */
+    
+    std::string GetTransportInfo() const;
+    
+    /**
+     *  Get the highest wire format version offered to the child.
+     *
+     *  \return The offered wire format version.
+     */
+    
+    MRH_Uint32 GetWireVersion() const noexcept;
 };
 
 #endif /* EventQueue_h */
@@ -0,0 +1,326 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+#include <chrono>
+#include <map>
+#include <array>
+#include <algorithm>
+
+// External
+
+// Project
+#include "./EventTrace.h"
+#include "../Logger/Logger.h"
+
+// Pre-defined
+namespace
+{
+#if MRH_CORE_EVENT_TRACING > 0
+    const char* p_StageName[EventTrace::STAGE_COUNT] =
+    {
+        "pool",
+        "core",
+        "queue",
+        "send"
+    };
+#endif
+    
+    // Histogram key, 4 bit stage, 20 bit type and endpoints
+    constexpr MRH_Uint32 u32_KeyMask = 0xFFFFF;
+    
+    inline MRH_Uint64 GetKey(MRH_Uint32 u32_Stage, MRH_Uint32 u32_Type, MRH_Uint32 u32_Source, MRH_Uint32 u32_Destination) noexcept
+    {
+        return (static_cast<MRH_Uint64>(u32_Stage) << 60) |
+               (static_cast<MRH_Uint64>(u32_Type & u32_KeyMask) << 40) |
+               (static_cast<MRH_Uint64>(u32_Source & u32_KeyMask) << 20) |
+               static_cast<MRH_Uint64>(u32_Destination & u32_KeyMask);
+    }
+}
+
+thread_local EventTrace::Owner EventTrace::c_Owner = { NULL };
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+EventTrace::EventTrace() noexcept
+{}
+
+EventTrace::~EventTrace() noexcept
+{}
+
+EventTrace::Owner::~Owner() noexcept
+{
+    if (p_Thread != NULL)
+    {
+        p_Thread->b_Owned.store(false, std::memory_order_release);
+    }
+}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+EventTrace& EventTrace::Singleton() noexcept
+{
+    static EventTrace c_EventTrace;
+    return c_EventTrace;
+}
+
+//*************************************************************************************
+// Thread
+//*************************************************************************************
+
+EventTrace::Thread* EventTrace::GetThread() noexcept
+{
+    if (c_Owner.p_Thread != NULL)
+    {
+        return c_Owner.p_Thread;
+    }
+    
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    
+    for (auto& Local : l_Thread)
+    {
+        bool b_Owned = false;
+        
+        if (Local.b_Owned.compare_exchange_strong(b_Owned, true, std::memory_order_acquire) == true)
+        {
+            c_Owner.p_Thread = &Local;
+            return c_Owner.p_Thread;
+        }
+    }
+    
+    try
+    {
+        l_Thread.emplace_back();
+        l_Thread.back().b_Owned = true;
+        c_Owner.p_Thread = &(l_Thread.back());
+    }
+    catch (...)
+    {}
+    
+    return c_Owner.p_Thread;
+}
+
+//*************************************************************************************
+// Trace
+//*************************************************************************************
+
+void EventTrace::Ingress(Event& c_Event, MRH_Uint32 u32_Source) noexcept
+{
+#if MRH_CORE_EVENT_TRACING > 0
+    // 0 marks events which were not traced
+    MRH_Uint32 u32_TimeUS = GetTimeUS();
+    
+    c_Event.u32_TraceUS = (u32_TimeUS > 0 ? u32_TimeUS : 1);
+    c_Event.u32_TraceSource = u32_Source;
+#else
+    (void)c_Event;
+    (void)u32_Source;
+#endif
+}
+
+void EventTrace::Record(Stage e_Stage, Event const& c_Event, MRH_Uint32 u32_Destination) noexcept
+{
+#if MRH_CORE_EVENT_TRACING > 0
+    if (c_Event.u32_TraceUS == 0)
+    {
+        return;
+    }
+    
+    // Wrapping time, correct for waits below ~71 minutes
+    MRH_Uint32 u32_WaitUS = GetTimeUS() - c_Event.u32_TraceUS;
+    Thread* p_Thread = GetThread();
+    
+    if (p_Thread == NULL)
+    {
+        return;
+    }
+    
+    // Only the owning thread adds histograms, lookup needs no lock
+    MRH_Uint64 u64_Key = GetKey(e_Stage, c_Event.u32_Type, c_Event.u32_TraceSource, u32_Destination);
+    auto Entry = p_Thread->m_Histogram.find(u64_Key);
+    Histogram* p_Histogram;
+    
+    if (Entry != p_Thread->m_Histogram.end())
+    {
+        p_Histogram = Entry->second.get();
+    }
+    else
+    {
+        try
+        {
+            std::lock_guard<std::mutex> c_Guard(p_Thread->c_Mutex);
+            p_Histogram = (p_Thread->m_Histogram[u64_Key] = std::unique_ptr<Histogram>(new Histogram())).get();
+        }
+        catch (...)
+        {
+            return;
+        }
+    }
+    
+    // Single writer, plain relaxed updates
+    size_t us_Bucket = (u32_WaitUS > 0 ? 32 - __builtin_clz(u32_WaitUS) : 0);
+    
+    p_Histogram->p_Bucket[us_Bucket].store(p_Histogram->p_Bucket[us_Bucket].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    
+    if (p_Histogram->u64_MaxUS.load(std::memory_order_relaxed) < u32_WaitUS)
+    {
+        p_Histogram->u64_MaxUS.store(u32_WaitUS, std::memory_order_relaxed);
+    }
+#else
+    (void)e_Stage;
+    (void)c_Event;
+    (void)u32_Destination;
+#endif
+}
+
+void EventTrace::LogStatistics() noexcept
+{
+#if MRH_CORE_EVENT_TRACING > 0
+    Logger& c_Logger = Logger::Singleton();
+    
+    try
+    {
+        // Merge all thread histograms by key, sorted for output
+        std::map<MRH_Uint64, std::array<MRH_Uint64, us_BucketCount + 1>> m_Merged;
+        std::vector<std::string> v_Name;
+        
+        {
+            std::lock_guard<std::mutex> c_Guard(c_Mutex);
+            
+            v_Name = v_Endpoint;
+            
+            for (auto& Local : l_Thread)
+            {
+                std::lock_guard<std::mutex> c_LocalGuard(Local.c_Mutex);
+                
+                for (auto& Entry : Local.m_Histogram)
+                {
+                    auto& Merged = m_Merged[Entry.first];
+                    
+                    for (size_t i = 0; i < us_BucketCount; ++i)
+                    {
+                        Merged[i] += Entry.second->p_Bucket[i].load(std::memory_order_relaxed);
+                    }
+                    
+                    Merged[us_BucketCount] = std::max(Merged[us_BucketCount], Entry.second->u64_MaxUS.load(std::memory_order_relaxed));
+                }
+            }
+        }
+        
+        for (auto& Merged : m_Merged)
+        {
+            MRH_Uint32 u32_Stage = static_cast<MRH_Uint32>(Merged.first >> 60);
+            MRH_Uint32 u32_Type = static_cast<MRH_Uint32>(Merged.first >> 40) & u32_KeyMask;
+            MRH_Uint32 u32_Source = static_cast<MRH_Uint32>(Merged.first >> 20) & u32_KeyMask;
+            MRH_Uint32 u32_Destination = static_cast<MRH_Uint32>(Merged.first) & u32_KeyMask;
+            MRH_Uint64 u64_Count = 0;
+            
+            for (size_t i = 0; i < us_BucketCount; ++i)
+            {
+                u64_Count += Merged.second[i];
+            }
+            
+            // Percentiles are given as the bucket upper bound
+            MRH_Uint64 p_Percentile[2] = { (u64_Count + 1) / 2, u64_Count - (u64_Count / 100) };
+            MRH_Uint64 p_BoundUS[2] = { 0, 0 };
+            
+            for (size_t i = 0; i < 2; ++i)
+            {
+                MRH_Uint64 u64_Sum = 0;
+                
+                for (size_t j = 0; j < us_BucketCount; ++j)
+                {
+                    u64_Sum += Merged.second[j];
+                    
+                    if (u64_Sum >= p_Percentile[i])
+                    {
+                        p_BoundUS[i] = (static_cast<MRH_Uint64>(1) << j) - 1;
+                        break;
+                    }
+                }
+            }
+            
+            c_Logger.Log(Logger::INFO, "Event trace " +
+                                       std::string(p_StageName[u32_Stage]) +
+                                       " type " +
+                                       std::to_string(u32_Type) +
+                                       " (" +
+                                       (u32_Source > 0 && u32_Source <= v_Name.size() ? v_Name[u32_Source - 1] : "core") +
+                                       " -> " +
+                                       (u32_Destination > 0 && u32_Destination <= v_Name.size() ? v_Name[u32_Destination - 1] : "core") +
+                                       "): " +
+                                       std::to_string(u64_Count) +
+                                       " events, p50 <= " +
+                                       std::to_string(p_BoundUS[0]) +
+                                       " us, p99 <= " +
+                                       std::to_string(p_BoundUS[1]) +
+                                       " us, max " +
+                                       std::to_string(Merged.second[us_BucketCount]) +
+                                       " us.",
+                         "EventTrace.cpp", __LINE__);
+        }
+    }
+    catch (std::exception& e)
+    {
+        c_Logger.Log(Logger::WARNING, "Failed to log event trace: " + std::string(e.what()),
+                     "EventTrace.cpp", __LINE__);
+    }
+#endif
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+MRH_Uint32 EventTrace::GetEndpoint(std::string const& s_Name) noexcept
+{
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    
+    for (size_t i = 0; i < v_Endpoint.size(); ++i)
+    {
+        if (v_Endpoint[i].compare(s_Name) == 0)
+        {
+            return static_cast<MRH_Uint32>(i + 1);
+        }
+    }
+    
+    if (v_Endpoint.size() >= u32_KeyMask)
+    {
+        return 0;
+    }
+    
+    try
+    {
+        v_Endpoint.emplace_back(s_Name);
+    }
+    catch (...)
+    {
+        return 0;
+    }
+    
+    return static_cast<MRH_Uint32>(v_Endpoint.size());
+}
+
+MRH_Uint32 EventTrace::GetTimeUS() noexcept
+{
+    return static_cast<MRH_Uint32>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
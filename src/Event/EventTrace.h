@@ -0,0 +1,217 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+ 
+#ifndef EventTrace_h
+#define EventTrace_h
+
+// C / C++
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <string>
+
+// External
+
+// Project
+#include "./Event.h"
+
+
+class EventTrace
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef enum
+    {
+        POOL = 0, // Moved to a service pool recieved queue
+        CORE = 1, // Retrieved by the main loop
+        QUEUE = 2, // Added to the destination send queue
+        SEND = 3, // Written to the destination
+        
+        STAGE_MAX = SEND,
+        
+        STAGE_COUNT = STAGE_MAX + 1
+        
+    }Stage;
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_EventTrace EventTrace class source.
+     */
+    
+    EventTrace(EventTrace const& c_EventTrace) = delete;
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance. This function is thread safe.
+     *
+     *  \return The class instance.
+     */
+    
+    static EventTrace& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Trace
+    //*************************************************************************************
+    
+    /**
+     *  Stamp a event with the ingress time. This function is thread safe.
+     *
+     *  \param c_Event The recieved event.
+     *  \param u32_Source The source endpoint.
+     */
+    
+    void Ingress(Event& c_Event, MRH_Uint32 u32_Source) noexcept;
+    
+    /**
+     *  Record the time since ingress for a stage. Events without ingress
+     *  time are ignored. This function is thread safe.
+     *
+     *  \param e_Stage The stage reached.
+     *  \param c_Event The traced event.
+     *  \param u32_Destination The destination endpoint, 0 for the core.
+     */
+    
+    void Record(Stage e_Stage, Event const& c_Event, MRH_Uint32 u32_Destination) noexcept;
+    
+    /**
+     *  Log the latency histograms of all threads. This function is thread safe.
+     */
+    
+    void LogStatistics() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the endpoint for a name. The endpoint is added if not known.
+     *  This function is thread safe.
+     *
+     *  \param s_Name The endpoint name.
+     *
+     *  \return The endpoint on success, 0 on failure.
+     */
+    
+    MRH_Uint32 GetEndpoint(std::string const& s_Name) noexcept;
+
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    // Bucket N holds wait times with N significant bits
+    static constexpr size_t us_BucketCount = 33;
+    
+    struct Histogram
+    {
+        // Written by the owning thread only
+        std::atomic<MRH_Uint64> p_Bucket[us_BucketCount];
+        std::atomic<MRH_Uint64> u64_MaxUS;
+    };
+    
+    struct Thread
+    {
+        // Locked for adding histograms and logging
+        std::mutex c_Mutex;
+        std::unordered_map<MRH_Uint64, std::unique_ptr<Histogram>> m_Histogram;
+        
+        // Threads reuse histograms of exited threads
+        std::atomic<bool> b_Owned;
+    };
+    
+    struct Owner
+    {
+        /**
+         *  Default destructor.
+         */
+        
+        ~Owner() noexcept;
+        
+        Thread* p_Thread;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    EventTrace() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~EventTrace() noexcept;
+    
+    //*************************************************************************************
+    // Thread
+    //*************************************************************************************
+    
+    /**
+     *  Get the histograms of the calling thread.
+     *
+     *  \return The thread histograms on success, NULL on failure.
+     */
+    
+    Thread* GetThread() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the current trace time.
+     *
+     *  \return The time in microseconds, wrapping around.
+     */
+    
+    static MRH_Uint32 GetTimeUS() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::mutex c_Mutex;
+    std::list<Thread> l_Thread;
+    std::vector<std::string> v_Endpoint;
+    
+    static thread_local Owner c_Owner;
+
+protected:
+
+};
+
+#endif /* EventTrace_h */
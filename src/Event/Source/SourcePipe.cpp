@@ -32,7 +32,8 @@
 // Constructor / Destructor
 //*************************************************************************************
 
-SourcePipe::SourcePipe() noexcept : TransmissionSource(TransmissionSource::PIPE)
+SourcePipe::SourcePipe() noexcept : TransmissionSource(TransmissionSource::PIPE),
+                                     us_Capacity(0)
 {
     for (size_t i = 0; i < PipeEnd::PIPE_END_COUNT; ++i)
     {
@@ -80,6 +81,21 @@ void SourcePipe::Open()
     {
         throw EventException("Failed to set pipe non-blocking: " + std::string(std::strerror(errno)) + " (" + std::to_string(errno) + ")!");
     }
+    
+    // Set capacity, the kernel rounds up to a power of 2 pages
+    // @NOTE: Failing to resize is not fatal, the pipe keeps the default
+    //        capacity (e.g. above /proc/sys/fs/pipe-max-size)
+    if (us_Capacity > 0 && fcntl(p_FD[PipeEnd::PIPE_END_WRITE], F_SETPIPE_SZ, static_cast<int>(us_Capacity < INT_MAX ? us_Capacity : INT_MAX)) < 0)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Could not set pipe capacity to " +
+                                                 std::to_string(us_Capacity) +
+                                                 " bytes: " +
+                                                 std::string(std::strerror(errno)) +
+                                                 " (" +
+                                                 std::to_string(errno) +
+                                                 ")!",
+                                "SourcePipe.cpp", __LINE__);
+    }
 }
 
 //*************************************************************************************
@@ -218,6 +234,43 @@ ssize_t SourcePipe::Write(const MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexce
     return ss_Write;
 }
 
+ssize_t SourcePipe::Write(const struct iovec* p_Vector, size_t us_Count) noexcept
+{
+    if (p_Vector == NULL || us_Count == 0)
+    {
+        return 0;
+    }
+    
+    // Remaining buffers are written on the next call
+    if (us_Count > IOV_MAX)
+    {
+        us_Count = IOV_MAX;
+    }
+    
+    ssize_t ss_Write;
+    
+    if ((ss_Write = writev(p_FD[PipeEnd::PIPE_END_WRITE], p_Vector, static_cast<int>(us_Count))) < 0 && errno != EAGAIN)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Could not write pipe: " +
+                                                 std::string(std::strerror(errno)) +
+                                                 " (" +
+                                                 std::to_string(errno) +
+                                                 ")!",
+                                "SourcePipe.cpp", __LINE__);
+    }
+    
+    return ss_Write;
+}
+
+//*************************************************************************************
+// Setters
+//*************************************************************************************
+
+void SourcePipe::SetCapacity(size_t us_Capacity) noexcept
+{
+    this->us_Capacity = us_Capacity;
+}
+
 //*************************************************************************************
 // Getters
 //*************************************************************************************
@@ -231,3 +284,25 @@ int SourcePipe::GetFD(PipeEnd e_End) const
     
     throw EventException("Invalid pipe end specified!");
 }
+
+int SourcePipe::GetReadPollFD() const noexcept
+{
+    return p_FD[PIPE_END_READ];
+}
+
+int SourcePipe::GetWritePollFD() const noexcept
+{
+    return p_FD[PIPE_END_WRITE];
+}
+
+size_t SourcePipe::GetCapacity() const noexcept
+{
+    int i_Capacity;
+    
+    if (p_FD[PipeEnd::PIPE_END_WRITE] < 0 || (i_Capacity = fcntl(p_FD[PipeEnd::PIPE_END_WRITE], F_GETPIPE_SZ)) < 0)
+    {
+        return 0;
+    }
+    
+    return static_cast<size_t>(i_Capacity);
+}
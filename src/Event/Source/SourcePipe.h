@@ -161,6 +161,30 @@ public:
       */
      
      ssize_t Write(const MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept override;
+     
+     /**
+      *  Write data to pipe from multiple buffers.
+      *
+      *  \param p_Vector The buffers to write from.
+      *  \param us_Count The amount of buffers to write from.
+      *
+      *  \return The amount of bytes written on success, -1 on failure.
+      */
+     
+     ssize_t Write(const struct iovec* p_Vector, size_t us_Count) noexcept override;
+    
+    //*************************************************************************************
+    // Setters
+    //*************************************************************************************
+    
+    /**
+     *  Set the requested pipe capacity. The capacity is applied the next
+     *  time the pipe is opened.
+     *
+     *  \param us_Capacity The capacity in bytes, 0 for the kernel default.
+     */
+    
+    void SetCapacity(size_t us_Capacity) noexcept override;
     
     //*************************************************************************************
     // Getters
@@ -176,6 +200,30 @@ public:
     
     int GetFD(PipeEnd e_End) const;
     
+    /**
+     *  Get the pipe read end file descriptor for polling.
+     *
+     *  \return The read end file descriptor.
+     */
+    
+    int GetReadPollFD() const noexcept override;
+    
+    /**
+     *  Get the pipe write end file descriptor for polling.
+     *
+     *  \return The write end file descriptor.
+     */
+    
+    int GetWritePollFD() const noexcept override;
+    
+    /**
+     *  Get the effective pipe capacity.
+     *
+     *  \return The capacity in bytes, 0 if the pipe is not open.
+     */
+    
+    size_t GetCapacity() const noexcept override;
+
 private:
     
     //*************************************************************************************
@@ -201,6 +249,9 @@ private:
     // Pipe ends
     int p_FD[PIPE_END_COUNT];
     
+    // Requested capacity
+    size_t us_Capacity;
+    
     // Polling
     struct pollfd c_PollFD;
     
@@ -0,0 +1,429 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <poll.h>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+// External
+
+// Project
+#include "./SourceSharedMemory.h"
+#include "../../Logger/Logger.h"
+
+// Pre-defined
+namespace
+{
+    // Ring layout version given to the child
+    constexpr MRH_Uint32 u32_RingVersion = 1;
+    
+    // Ring data size, has to be a power of 2
+    constexpr MRH_Uint32 u32_RingCapacity = 65536;
+    
+    static_assert((u32_RingCapacity & (u32_RingCapacity - 1)) == 0, "Ring capacity has to be a power of 2!");
+    static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared ring requires lock free atomics!");
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+SourceSharedMemory::SourceSharedMemory() noexcept : TransmissionSource(TransmissionSource::SHARED_MEMORY),
+                                                    i_MemoryFD(-1),
+                                                    p_Ring(NULL),
+                                                    p_Buffer(NULL),
+                                                    us_MapSize(0),
+                                                    u32_ReadPos(0),
+                                                    u32_WritePos(0),
+                                                    b_Failed(false),
+                                                    i_NotifyFD(-1)
+{}
+
+SourceSharedMemory::~SourceSharedMemory() noexcept
+{
+    Close();
+}
+
+//*************************************************************************************
+// Reset
+//*************************************************************************************
+
+void SourceSharedMemory::Reset()
+{
+    try
+    {
+        Close();
+        Open();
+    }
+    catch (EventException& e)
+    {
+        throw EventException(e.what());
+    }
+}
+
+//*************************************************************************************
+// Open
+//*************************************************************************************
+
+void SourceSharedMemory::Open()
+{
+    // Create shared memory, inherited by the child like a pipe
+    us_MapSize = sizeof(Ring) + u32_RingCapacity;
+    
+    if ((i_MemoryFD = memfd_create("mrhcore_event_ring", 0)) < 0)
+    {
+        throw EventException("Failed to create shared memory: " + std::string(std::strerror(errno)) + " (" + std::to_string(errno) + ")!");
+    }
+    
+    if (ftruncate(i_MemoryFD, us_MapSize) < 0)
+    {
+        int i_Error = errno;
+        Close();
+        throw EventException("Failed to size shared memory: " + std::string(std::strerror(i_Error)) + " (" + std::to_string(i_Error) + ")!");
+    }
+    
+    void* p_Map = mmap(NULL, us_MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, i_MemoryFD, 0);
+    
+    if (p_Map == MAP_FAILED)
+    {
+        int i_Error = errno;
+        Close();
+        throw EventException("Failed to map shared memory: " + std::string(std::strerror(i_Error)) + " (" + std::to_string(i_Error) + ")!");
+    }
+    
+    p_Ring = new (p_Map) Ring();
+    p_Ring->u32_Version = u32_RingVersion;
+    p_Ring->u32_Capacity = u32_RingCapacity;
+    p_Ring->u32_Head.store(0);
+    p_Ring->u32_Tail.store(0);
+    p_Ring->u32_Waiting.store(0);
+    p_Buffer = static_cast<MRH_Uint8*>(p_Map) + sizeof(Ring);
+    
+    u32_ReadPos = 0;
+    u32_WritePos = 0;
+    b_Failed = false;
+    
+    // Create reader notification
+    if ((i_NotifyFD = eventfd(0, EFD_NONBLOCK)) < 0)
+    {
+        int i_Error = errno;
+        Close();
+        throw EventException("Failed to create ring notification: " + std::string(std::strerror(i_Error)) + " (" + std::to_string(i_Error) + ")!");
+    }
+}
+
+//*************************************************************************************
+// Close
+//*************************************************************************************
+
+void SourceSharedMemory::Close()
+{
+    if (p_Ring != NULL)
+    {
+        p_Ring->~Ring();
+        munmap(p_Ring, us_MapSize);
+        
+        p_Ring = NULL;
+        p_Buffer = NULL;
+    }
+    
+    if (i_MemoryFD > -1)
+    {
+        close(i_MemoryFD);
+        i_MemoryFD = -1;
+    }
+    
+    if (i_NotifyFD > -1)
+    {
+        close(i_NotifyFD);
+        i_NotifyFD = -1;
+    }
+}
+
+//*************************************************************************************
+// Read
+//*************************************************************************************
+
+bool SourceSharedMemory::CanRead(MRH_Sint32 s32_TimeoutMS) noexcept
+{
+    if (p_Ring == NULL)
+    {
+        return false;
+    }
+    else if (GetReadable() > 0)
+    {
+        return true;
+    }
+    else if (s32_TimeoutMS <= 0)
+    {
+        return false;
+    }
+    
+    // Announce waiting before checking again, the producer only
+    // notifies while the consumer waits
+    p_Ring->u32_Waiting.store(1, std::memory_order_seq_cst);
+    
+    if (GetReadable() == 0)
+    {
+        struct pollfd c_PollFD;
+        c_PollFD.fd = i_NotifyFD;
+        c_PollFD.events = POLLIN;
+        
+        if (poll(&c_PollFD, 1, s32_TimeoutMS) < 0)
+        {
+            Logger::Singleton().Log(Logger::WARNING, "Could not poll ring notification: " +
+                                                     std::string(std::strerror(errno)) +
+                                                     " (" +
+                                                     std::to_string(errno) +
+                                                     ")!",
+                                    "SourceSharedMemory.cpp", __LINE__);
+        }
+    }
+    
+    p_Ring->u32_Waiting.store(0, std::memory_order_relaxed);
+    
+    // Clear notification, nothing to read on EAGAIN
+    eventfd_t u64_Value;
+    eventfd_read(i_NotifyFD, &u64_Value);
+    
+    return GetReadable() > 0;
+}
+
+ssize_t SourceSharedMemory::Read(std::vector<MRH_Uint8>& v_Data, MRH_Uint32 u32_Length) noexcept
+{
+    return Read(v_Data.data(), u32_Length);
+}
+
+ssize_t SourceSharedMemory::Read(MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept
+{
+    if (p_Ring == NULL)
+    {
+        return -1;
+    }
+    else if (p_Data == NULL || u32_Length == 0)
+    {
+        return 0;
+    }
+    
+    // End an external wait, the ring is read now
+    if (p_Ring->u32_Waiting.load(std::memory_order_relaxed) != 0)
+    {
+        p_Ring->u32_Waiting.store(0, std::memory_order_relaxed);
+    }
+    
+    // Only the head is taken from the child, the tail is our own
+    MRH_Uint32 u32_Tail = u32_ReadPos;
+    MRH_Uint32 u32_Readable = p_Ring->u32_Head.load(std::memory_order_acquire) - u32_Tail;
+    
+    if (u32_Readable > u32_RingCapacity)
+    {
+        SetFailed("Ring head moved past the ring capacity");
+        return -1;
+    }
+    else if (u32_Length > u32_Readable)
+    {
+        u32_Length = u32_Readable;
+    }
+    
+    // Copy with wrap around
+    MRH_Uint32 u32_Pos = u32_Tail & (u32_RingCapacity - 1);
+    MRH_Uint32 u32_First = u32_RingCapacity - u32_Pos;
+    
+    if (u32_First >= u32_Length)
+    {
+        std::memcpy(p_Data, p_Buffer + u32_Pos, u32_Length);
+    }
+    else
+    {
+        std::memcpy(p_Data, p_Buffer + u32_Pos, u32_First);
+        std::memcpy(p_Data + u32_First, p_Buffer, u32_Length - u32_First);
+    }
+    
+    u32_ReadPos = u32_Tail + u32_Length;
+    p_Ring->u32_Tail.store(u32_ReadPos, std::memory_order_release);
+    
+    return u32_Length;
+}
+
+//*************************************************************************************
+// Write
+//*************************************************************************************
+
+ssize_t SourceSharedMemory::Write(std::vector<MRH_Uint8>& v_Data, MRH_Uint32 u32_Length) noexcept
+{
+    return Write((const MRH_Uint8*)&(v_Data[0]), u32_Length);
+}
+
+ssize_t SourceSharedMemory::Write(const MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept
+{
+    struct iovec c_Vector;
+    c_Vector.iov_base = const_cast<MRH_Uint8*>(p_Data);
+    c_Vector.iov_len = u32_Length;
+    
+    return Write(&c_Vector, 1);
+}
+
+ssize_t SourceSharedMemory::Write(const struct iovec* p_Vector, size_t us_Count) noexcept
+{
+    if (p_Ring == NULL)
+    {
+        return -1;
+    }
+    else if (p_Vector == NULL || us_Count == 0)
+    {
+        return 0;
+    }
+    
+    // Only the tail is taken from the child, the head is our own
+    MRH_Uint32 u32_Head = u32_WritePos;
+    MRH_Uint32 u32_Used = u32_Head - p_Ring->u32_Tail.load(std::memory_order_acquire);
+    
+    if (u32_Used > u32_RingCapacity)
+    {
+        SetFailed("Ring tail moved past the ring head");
+        return -1;
+    }
+    
+    MRH_Uint32 u32_Free = u32_RingCapacity - u32_Used;
+    MRH_Uint32 u32_Written = 0;
+    
+    // Copy as much as fits, frames are written directly into the ring
+    for (size_t i = 0; i < us_Count && u32_Free > 0; ++i)
+    {
+        const MRH_Uint8* p_Data = static_cast<const MRH_Uint8*>(p_Vector[i].iov_base);
+        MRH_Uint32 u32_Length = (p_Vector[i].iov_len < u32_Free ? static_cast<MRH_Uint32>(p_Vector[i].iov_len) : u32_Free);
+        
+        if (u32_Length == 0)
+        {
+            continue;
+        }
+        
+        MRH_Uint32 u32_Pos = (u32_Head + u32_Written) & (u32_RingCapacity - 1);
+        MRH_Uint32 u32_First = u32_RingCapacity - u32_Pos;
+        
+        if (u32_First >= u32_Length)
+        {
+            std::memcpy(p_Buffer + u32_Pos, p_Data, u32_Length);
+        }
+        else
+        {
+            std::memcpy(p_Buffer + u32_Pos, p_Data, u32_First);
+            std::memcpy(p_Buffer, p_Data + u32_First, u32_Length - u32_First);
+        }
+        
+        u32_Written += u32_Length;
+        u32_Free -= u32_Length;
+    }
+    
+    if (u32_Written == 0)
+    {
+        return 0;
+    }
+    
+    // Publish, then wake the consumer only if it waits
+    u32_WritePos = u32_Head + u32_Written;
+    p_Ring->u32_Head.store(u32_WritePos, std::memory_order_seq_cst);
+    
+    if (p_Ring->u32_Waiting.load(std::memory_order_seq_cst) != 0 && eventfd_write(i_NotifyFD, 1) < 0)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Could not notify ring reader: " +
+                                                 std::string(std::strerror(errno)) +
+                                                 " (" +
+                                                 std::to_string(errno) +
+                                                 ")!",
+                                "SourceSharedMemory.cpp", __LINE__);
+    }
+    
+    return u32_Written;
+}
+
+//*************************************************************************************
+// Poll
+//*************************************************************************************
+
+bool SourceSharedMemory::PrepareReadPoll() noexcept
+{
+    if (p_Ring == NULL)
+    {
+        return true;
+    }
+    
+    // Clear old notifications, then announce waiting before checking
+    // again like CanRead()
+    eventfd_t u64_Value;
+    eventfd_read(i_NotifyFD, &u64_Value);
+    
+    p_Ring->u32_Waiting.store(1, std::memory_order_seq_cst);
+    
+    return GetReadable() == 0;
+}
+
+//*************************************************************************************
+// Setters
+//*************************************************************************************
+
+void SourceSharedMemory::SetFailed(std::string const& s_Reason) noexcept
+{
+    Logger::Singleton().Log(Logger::ERROR, "Closing corrupt shared memory ring: " +
+                                           s_Reason +
+                                           "!",
+                            "SourceSharedMemory.cpp", __LINE__);
+    
+    // The child wrote garbage, nothing in the ring can be trusted
+    Close();
+    b_Failed = true;
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+MRH_Uint32 SourceSharedMemory::GetReadable() const noexcept
+{
+    // A corrupt head is returned as readable, Read() closes the ring
+    return p_Ring->u32_Head.load(std::memory_order_seq_cst) - u32_ReadPos;
+}
+
+int SourceSharedMemory::GetMemoryFD() const noexcept
+{
+    return i_MemoryFD;
+}
+
+int SourceSharedMemory::GetNotifyFD() const noexcept
+{
+    return i_NotifyFD;
+}
+
+int SourceSharedMemory::GetReadPollFD() const noexcept
+{
+    return i_NotifyFD;
+}
+
+size_t SourceSharedMemory::GetCapacity() const noexcept
+{
+    return (p_Ring != NULL ? u32_RingCapacity : 0);
+}
+
+bool SourceSharedMemory::GetFailed() const noexcept
+{
+    return b_Failed;
+}
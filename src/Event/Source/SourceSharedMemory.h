@@ -0,0 +1,284 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+#ifndef SourceSharedMemory_h
+#define SourceSharedMemory_h
+
+// C / C++
+#include <atomic>
+#include <string>
+
+// External
+
+// Project
+#include "TransmissionSource.h"
+#include "../EventException.h"
+
+
+class SourceSharedMemory : public TransmissionSource
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    SourceSharedMemory() noexcept;
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_SourceSharedMemory SourceSharedMemory class source.
+     */
+    
+    SourceSharedMemory(SourceSharedMemory const& c_SourceSharedMemory) = delete;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~SourceSharedMemory() noexcept;
+    
+    //*************************************************************************************
+    // Reset
+    //*************************************************************************************
+    
+    /**
+     *  Reset the shared memory ring.
+     */
+    
+    void Reset() override;
+    
+    //*************************************************************************************
+    // Open
+    //*************************************************************************************
+    
+    /**
+     *  Create and map the shared memory ring.
+     */
+    
+    void Open() override;
+    
+    //*************************************************************************************
+    // Close
+    //*************************************************************************************
+    
+    /**
+     *  Unmap and close the shared memory ring.
+     */
+    
+    void Close() override;
+    
+    //*************************************************************************************
+    // Read
+    //*************************************************************************************
+    
+    /**
+     *  Check if the ring contains data to read.
+     *
+     *  \param s32_TimeoutMS The data check timeout (blocking) in milliseconds.
+     *
+     *  \return true if data can be read, false if not.
+     */
+    
+    bool CanRead(MRH_Sint32 s32_TimeoutMS) noexcept override;
+    
+    /**
+     *  Read data from the ring to a vector.
+     *
+     *  \param v_Data The byte data vector to read to.
+     *  \param u32_Length The length in bytes to read.
+     *
+     *  \return The amount of bytes read on success, -1 on failure.
+     */
+    
+    ssize_t Read(std::vector<MRH_Uint8>& v_Data, MRH_Uint32 u32_Length) noexcept override;
+    
+    /**
+     *  Read data from the ring to a buffer.
+     *
+     *  \param p_Data The byte data buffer to read to. This buffer has to be allocated.
+     *  \param u32_Length The length in bytes to read.
+     *
+     *  \return The amount of bytes read on success, -1 on failure.
+     */
+    
+    ssize_t Read(MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept override;
+    
+    //*************************************************************************************
+    // Write
+    //*************************************************************************************
+     
+     /**
+      *  Write data to the ring from a vector.
+      *
+      *  \param v_Data The byte data vector to write from.
+      *  \param u32_Length The length in bytes to write.
+      *
+      *  \return The amount of bytes written on success, -1 on failure.
+      */
+     
+     ssize_t Write(std::vector<MRH_Uint8>& v_Data, MRH_Uint32 u32_Length) noexcept override;
+     
+     /**
+      *  Write data to the ring from a buffer.
+      *
+      *  \param p_Data The byte data buffer to write from.
+      *  \param u32_Length The length in bytes to write.
+      *
+      *  \return The amount of bytes written on success, -1 on failure.
+      */
+     
+     ssize_t Write(const MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept override;
+     
+     /**
+      *  Write data to the ring from multiple buffers.
+      *
+      *  \param p_Vector The buffers to write from.
+      *  \param us_Count The amount of buffers to write from.
+      *
+      *  \return The amount of bytes written on success, -1 on failure.
+      */
+     
+     ssize_t Write(const struct iovec* p_Vector, size_t us_Count) noexcept override;
+    
+    //*************************************************************************************
+    // Poll
+    //*************************************************************************************
+    
+    /**
+     *  Announce a wait on the notification file descriptor. The writer
+     *  notifies until the next read.
+     *
+     *  \return true if the ring can be waited on, false if data is already readable.
+     */
+    
+    bool PrepareReadPoll() noexcept override;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the shared memory file descriptor.
+     *
+     *  \return The shared memory file descriptor.
+     */
+    
+    int GetMemoryFD() const noexcept;
+    
+    /**
+     *  Get the reader notification file descriptor.
+     *
+     *  \return The eventfd file descriptor.
+     */
+    
+    int GetNotifyFD() const noexcept;
+    
+    /**
+     *  Get the reader notification file descriptor for polling.
+     *
+     *  \return The eventfd file descriptor.
+     */
+    
+    int GetReadPollFD() const noexcept override;
+    
+    /**
+     *  Get the ring buffer capacity.
+     *
+     *  \return The capacity in bytes, 0 if the memory is not mapped.
+     */
+    
+    size_t GetCapacity() const noexcept override;
+    
+    /**
+     *  Check if the ring was closed because the child corrupted it.
+     *
+     *  \return true if the ring is corrupt, false if not.
+     */
+    
+    bool GetFailed() const noexcept override;
+
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    // @NOTE: Shared with the child process, the layout is part of the
+    //        child interface. Positions are free running and wrap.
+    struct Ring
+    {
+        MRH_Uint32 u32_Version;
+        MRH_Uint32 u32_Capacity;
+        
+        alignas(64) std::atomic<MRH_Uint32> u32_Head; // Written by producer
+        alignas(64) std::atomic<MRH_Uint32> u32_Tail; // Written by consumer
+        alignas(64) std::atomic<MRH_Uint32> u32_Waiting; // Consumer waits for notification
+    };
+    
+    //*************************************************************************************
+    // Setters
+    //*************************************************************************************
+    
+    /**
+     *  Close the ring after the child corrupted it.
+     *
+     *  \param s_Reason The corruption description.
+     */
+    
+    void SetFailed(std::string const& s_Reason) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of readable bytes.
+     *
+     *  \return The readable byte count.
+     */
+    
+    MRH_Uint32 GetReadable() const noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // Shared memory
+    int i_MemoryFD;
+    Ring* p_Ring;
+    MRH_Uint8* p_Buffer;
+    size_t us_MapSize;
+    
+    // Positions owned by mrhcore, the shared copies are only published
+    // @NOTE: The child can write the shared positions at any time
+    MRH_Uint32 u32_ReadPos;
+    MRH_Uint32 u32_WritePos;
+    bool b_Failed;
+    
+    // Notification
+    int i_NotifyFD;
+
+protected:
+
+};
+
+#endif /* SourceSharedMemory_h */
@@ -86,6 +86,52 @@ ssize_t TransmissionSource::Write(const MRH_Uint8* p_Data, MRH_Uint32 u32_Length
     return 0;
 }
 
+ssize_t TransmissionSource::Write(const struct iovec* p_Vector, size_t us_Count) noexcept
+{
+    // Write each buffer on its own for sources without gather writes
+    ssize_t ss_Total = 0;
+    ssize_t ss_Write;
+    
+    for (size_t i = 0; i < us_Count; ++i)
+    {
+        if (p_Vector[i].iov_len == 0)
+        {
+            continue;
+        }
+        
+        if ((ss_Write = Write((const MRH_Uint8*)(p_Vector[i].iov_base), p_Vector[i].iov_len)) < 0)
+        {
+            return (ss_Total > 0 ? ss_Total : ss_Write);
+        }
+        
+        ss_Total += ss_Write;
+        
+        // Partial write, source is full
+        if (static_cast<size_t>(ss_Write) < p_Vector[i].iov_len)
+        {
+            break;
+        }
+    }
+    
+    return ss_Total;
+}
+
+//*************************************************************************************
+// Poll
+//*************************************************************************************
+
+bool TransmissionSource::PrepareReadPoll() noexcept
+{
+    return true;
+}
+
+//*************************************************************************************
+// Setters
+//*************************************************************************************
+
+void TransmissionSource::SetCapacity(size_t) noexcept
+{}
+
 //*************************************************************************************
 // Getters
 //*************************************************************************************
@@ -94,3 +140,23 @@ TransmissionSource::SourceType TransmissionSource::GetType() const noexcept
 {
     return e_Type;
 }
+
+int TransmissionSource::GetReadPollFD() const noexcept
+{
+    return -1;
+}
+
+int TransmissionSource::GetWritePollFD() const noexcept
+{
+    return -1;
+}
+
+size_t TransmissionSource::GetCapacity() const noexcept
+{
+    return 0;
+}
+
+bool TransmissionSource::GetFailed() const noexcept
+{
+    return false;
+}
@@ -19,6 +19,7 @@
 
 // C / C++
 #include <sys/types.h> // ssize_t
+#include <sys/uio.h> // iovec
 #include <vector>
 
 // External
@@ -39,10 +40,11 @@ public:
     {
         MRHCKM = 0,
         PIPE = 1,
+        SHARED_MEMORY = 2,
         
-        SOURCE_TYPE_MAX = 1,
+        SOURCE_TYPE_MAX = SHARED_MEMORY,
         
-        SOURCE_TYPE_COUNT = 2
+        SOURCE_TYPE_COUNT = SOURCE_TYPE_MAX + 1
         
     }SourceType;
     
@@ -147,6 +149,42 @@ public:
       */
      
      virtual ssize_t Write(const MRH_Uint8* p_Data, MRH_Uint32 u32_Length) noexcept;
+     
+     /**
+      *  Write data to transmission source from multiple buffers.
+      *
+      *  \param p_Vector The buffers to write from.
+      *  \param us_Count The amount of buffers to write from.
+      *
+      *  \return The amount of bytes written on success, -1 on failure.
+      */
+     
+     virtual ssize_t Write(const struct iovec* p_Vector, size_t us_Count) noexcept;
+    
+    //*************************************************************************************
+    // Poll
+    //*************************************************************************************
+    
+    /**
+     *  Prepare the source for an external wait on the read poll file descriptor.
+     *
+     *  \return true if the source can be waited on, false if data is already readable.
+     */
+    
+    virtual bool PrepareReadPoll() noexcept;
+    
+    //*************************************************************************************
+    // Setters
+    //*************************************************************************************
+    
+    /**
+     *  Set the requested source capacity. The capacity is applied the next
+     *  time the source is opened.
+     *
+     *  \param us_Capacity The capacity in bytes, 0 for the source default.
+     */
+    
+    virtual void SetCapacity(size_t us_Capacity) noexcept;
     
     //*************************************************************************************
     // Getters
@@ -160,6 +198,39 @@ public:
 
     SourceType GetType() const noexcept;
     
+    /**
+     *  Get the file descriptor which becomes readable once data can be read.
+     *
+     *  \return The file descriptor on success, -1 if not available.
+     */
+    
+    virtual int GetReadPollFD() const noexcept;
+    
+    /**
+     *  Get the file descriptor which becomes writable once data can be written.
+     *
+     *  \return The file descriptor on success, -1 if not available.
+     */
+    
+    virtual int GetWritePollFD() const noexcept;
+    
+    /**
+     *  Get the effective capacity of the opened source.
+     *
+     *  \return The capacity in bytes, 0 if unknown.
+     */
+    
+    virtual size_t GetCapacity() const noexcept;
+    
+    /**
+     *  Check if the source was closed because the other end broke the
+     *  transmission.
+     *
+     *  \return true if the source failed, false if not.
+     */
+    
+    virtual bool GetFailed() const noexcept;
+
 private:
     
     //*************************************************************************************
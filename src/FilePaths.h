@@ -80,6 +80,10 @@
     #define MRH_CORE_INPUT_STOP_TRIGGER_FILE "Stop.mrhit"
 #endif
 
+#ifndef MRH_CORE_EVENT_LOG_CONTROL_FILE_PATH
+    #define MRH_CORE_EVENT_LOG_CONTROL_FILE_PATH "/var/mrh/mrhcore/EventLog.conf"
+#endif
+
 //*************************************************************************************
 // Log Paths
 //*************************************************************************************
@@ -132,7 +132,7 @@ void InputLaunch::UpdateLaunch(Event const& c_Event)
 void InputLaunch::UpdateLaunch(std::string s_PackagePath, std::string s_LaunchInput, int i_LaunchCommand)
 {
     // Only allow requests which exists, stop unlisted packages
-    if (PackageContainer::Singleton().GetPackageExists(s_PackagePath) == false)
+    if (PackageContainer::Singleton().GetCatalog()->GetPackageExists(s_PackagePath) == false)
     {
         throw InputException("Tried to launch unknown package " + s_PackagePath, "Launch");
     }
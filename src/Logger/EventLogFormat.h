@@ -0,0 +1,144 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+#ifndef EventLogFormat_h
+#define EventLogFormat_h
+
+// C / C++
+#include <cstddef>
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+
+
+class EventLogFormat
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef enum
+    {
+        RECORD_EVENT = 0,                        // Logged event, followed by the event data
+        RECORD_PROCESS = 1,                      // Process name, followed by the name string
+        
+        RECORD_TYPE_MAX = RECORD_PROCESS,
+        
+        RECORD_TYPE_COUNT = RECORD_TYPE_MAX + 1
+        
+    }RecordType;
+    
+    typedef enum
+    {
+        RECIEVED = 0,
+        SENT = 1,
+        
+        DIRECTION_MAX = SENT,
+        
+        DIRECTION_COUNT = DIRECTION_MAX + 1
+        
+    }Direction;
+    
+    typedef enum
+    {
+        USER = 0,
+        USER_SERVICE = 1,
+        PLATFORM_SERVICE = 2,
+        QUEUE = 3,                               // Default event queue, no process
+        
+        SOURCE_MAX = QUEUE,
+        
+        SOURCE_COUNT = SOURCE_MAX + 1
+        
+    }Source;
+    
+    // @NOTE: All values are stored in host byte order
+    struct FileHeader
+    {
+        MRH_Uint64 u64_Magic;
+        MRH_Uint32 u32_Version;
+        MRH_Uint32 u32_PayloadLimit;             // Max event data bytes stored per record
+    };
+    
+    struct RecordHeader
+    {
+        MRH_Uint32 u32_RecordSize;               // Full record size, including header and padding
+        MRH_Uint16 u16_RecordType;
+        MRH_Uint8 u8_Direction;
+        MRH_Uint8 u8_Source;
+        MRH_Uint64 u64_TimeNS;                   // Realtime clock
+        MRH_Uint64 u64_Sequence;
+        MRH_Uint32 u32_ProcessID;                // Source or destination process
+        MRH_Uint32 u32_GroupID;
+        MRH_Uint32 u32_Type;
+        MRH_Uint32 u32_DataSize;                 // Full event data size
+        MRH_Uint32 u32_PayloadSize;              // Bytes following the header
+        MRH_Uint32 u32_Reserved;
+    };
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the full record size for a payload size.
+     *
+     *  \param u32_PayloadSize The payload size in bytes.
+     *
+     *  \return The record size with header and padding.
+     */
+    
+    static constexpr MRH_Uint32 GetRecordSize(MRH_Uint32 u32_PayloadSize) noexcept
+    {
+        return (sizeof(RecordHeader) + u32_PayloadSize + (us_RecordAlignment - 1)) & ~(us_RecordAlignment - 1);
+    }
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    static constexpr MRH_Uint64 u64_Magic = 0x474F4C564548524D; // "MRHEVLOG"
+    static constexpr MRH_Uint32 u32_Version = 1;
+    static constexpr size_t us_RecordAlignment = 8;
+    
+    // Payload bounds, process names are cut and larger event payload limits are invalid
+    static constexpr MRH_Uint32 u32_NameLimit = 1024;
+    static constexpr MRH_Uint32 u32_PayloadLimitMax = 16 * 1024 * 1024;
+
+private:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. Disabled for this class.
+     */
+    
+    EventLogFormat() = delete;
+
+protected:
+
+};
+
+static_assert(sizeof(EventLogFormat::FileHeader) == 16, "Unexpected event log file header size!");
+static_assert(sizeof(EventLogFormat::RecordHeader) == 48, "Unexpected event log record header size!");
+
+#endif /* EventLogFormat_h */
@@ -15,20 +15,24 @@
  */
 
 // C / C++
-#include <execinfo.h>
-#include <unistd.h>
-#include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <poll.h>
 #include <iostream>
+#include <stdexcept>
+#include <cstring>
 #include <ctime>
-#include <vector>
-#include <iostream>
 
 // External
+#include <libmrhbf.h>
 
 // Project
 #include "./EventLogger.h"
 #include "./Logger.h"
+#include "../Event/EventMeta.h"
+#include "../FilePaths.h"
 
 // Pre-defined
 #ifndef MRH_CORE_EVENT_LOG_FILE_PATH
@@ -37,27 +41,192 @@
 #ifndef MRH_EVENT_LOGGER_PRINT_CLI
     #define MRH_EVENT_LOGGER_PRINT_CLI 0
 #endif
+#ifndef MRH_EVENT_LOGGER_BUFFER_SIZE
+    #define MRH_EVENT_LOGGER_BUFFER_SIZE 65536
+#endif
+#ifndef MRH_EVENT_LOGGER_PAYLOAD_LIMIT
+    #define MRH_EVENT_LOGGER_PAYLOAD_LIMIT 256
+#endif
+#ifndef MRH_CORE_EVENT_LOGGING
+    #define MRH_CORE_EVENT_LOGGING 0
+#endif
+
+namespace
+{
+    // Write buffered records at least once per second
+    constexpr MRH_Uint64 u64_WriteIntervalNS = 1000 * 1000 * 1000;
+    
+    // Used by fork handlers, which might run during singleton creation
+    EventLogger* p_ForkEventLogger = NULL;
+    
+    MRH_Uint64 GetTimeNS() noexcept
+    {
+        struct timespec c_Time;
+        clock_gettime(CLOCK_REALTIME, &c_Time);
+        
+        return (static_cast<MRH_Uint64>(c_Time.tv_sec) * 1000 * 1000 * 1000) + static_cast<MRH_Uint64>(c_Time.tv_nsec);
+    }
+    
+    enum Identifier
+    {
+        // Block Name
+        BLOCK_EVENT_LOG = 0,
+        
+        // Control Key
+        ENABLED = 1,
+        TYPE_MIN = 2,
+        TYPE_MAX = 3,
+        SOURCE = 4,
+        DIRECTION = 5,
+        PROCESS = 6,
+        SAMPLE_RATE = 7,
+        
+        // Source, ordered as EventLogFormat::Source
+        SOURCE_USER = 8,
+        SOURCE_USER_SERVICE = 9,
+        SOURCE_PLATFORM_SERVICE = 10,
+        SOURCE_QUEUE = 11,
+        
+        // Direction, ordered as EventLogFormat::Direction
+        DIRECTION_RECIEVED = 12,
+        DIRECTION_SENT = 13,
+        
+        // Bounds
+        IDENTIFIER_MAX = DIRECTION_SENT,
+        
+        IDENTIFIER_COUNT = IDENTIFIER_MAX + 1
+    };
+    
+    const char* p_Identifier[IDENTIFIER_COUNT] =
+    {
+        // Block Name
+        "EventLog",
+        
+        // Control Key
+        "Enabled",
+        "TypeMin",
+        "TypeMax",
+        "Source",
+        "Direction",
+        "Process",
+        "SampleRate",
+        
+        // Source
+        "User",
+        "UserService",
+        "PlatformService",
+        "Queue",
+        
+        // Direction
+        "Recieved",
+        "Sent"
+    };
+    
+    std::string GetOptionalValue(MRH_ValueBlock& c_Block, const char* p_Key) noexcept
+    {
+        // Missing optional values keep their defaults
+        try
+        {
+            return c_Block.GetValue(p_Key);
+        }
+        catch (...)
+        {
+            return "";
+        }
+    }
+    
+    MRH_Uint32 ParseMask(std::string const& s_Value, Identifier e_First, size_t us_Count)
+    {
+        // Comma separated names, each sets the bit of its position
+        MRH_Uint32 u32_Mask = 0;
+        size_t us_Start = 0;
+        
+        while (us_Start <= s_Value.size())
+        {
+            size_t us_End = s_Value.find(',', us_Start);
+            
+            if (us_End == std::string::npos)
+            {
+                us_End = s_Value.size();
+            }
+            
+            std::string s_Name = s_Value.substr(us_Start, us_End - us_Start);
+            s_Name.erase(0, s_Name.find_first_not_of(' '));
+            s_Name.erase(s_Name.find_last_not_of(' ') + 1);
+            
+            size_t i = 0;
+            
+            while (i < us_Count && s_Name.compare(p_Identifier[e_First + i]) != 0)
+            {
+                ++i;
+            }
+            
+            if (i == us_Count)
+            {
+                throw std::invalid_argument("Unknown event log filter value: " + s_Name);
+            }
+            
+            u32_Mask |= (1 << i);
+            us_Start = us_End + 1;
+        }
+        
+        return u32_Mask;
+    }
+}
+
+static_assert(EventLogFormat::GetRecordSize(MRH_EVENT_LOGGER_PAYLOAD_LIMIT) <= MRH_EVENT_LOGGER_BUFFER_SIZE &&
+              EventLogFormat::GetRecordSize(EventLogFormat::u32_NameLimit) <= MRH_EVENT_LOGGER_BUFFER_SIZE,
+              "Event log buffer too small for a single record!");
+static_assert(MRH_EVENT_LOGGER_PAYLOAD_LIMIT <= EventLogFormat::u32_PayloadLimitMax,
+              "Event log payload limit too large!");
+
+std::atomic<bool> EventLogger::b_Enabled(MRH_CORE_EVENT_LOGGING > 0);
 
 
 //*************************************************************************************
 // Constructor / Destructor
 //*************************************************************************************
 
-EventLogger::EventLogger() noexcept : u64_EventID(0)
+EventLogger::EventLogger() noexcept : us_BufferPos(0),
+                                      u64_WriteTimeNS(GetTimeNS()),
+                                      p_Writer(NULL),
+                                      i_WriterFD(-1),
+                                      b_Run(true),
+                                      u64_EventID(0),
+                                      u32_SampleCount(0)
 {
-    f_EventLogFile.open(MRH_CORE_EVENT_LOG_FILE_PATH, std::ios::out | std::ios::trunc);
+    // Log everything until a control file says otherwise
+    c_Filter.u32_TypeMin = 0;
+    c_Filter.u32_TypeMax = 0xFFFFFFFF;
+    c_Filter.u32_SourceMask = 0xFFFFFFFF;
+    c_Filter.u32_DirectionMask = 0xFFFFFFFF;
+    c_Filter.s_Process = "";
+    c_Filter.u32_SampleRate = 1;
     
-    if (f_EventLogFile.is_open() == false)
-    {
-        Logger::Singleton().Log(Logger::WARNING, "Failed to open backtrace file: " MRH_CORE_EVENT_LOG_FILE_PATH,
-                                "Logger.cpp", __LINE__);
-    }
+    // Forked children drop the buffer, the parent writes it
+    p_ForkEventLogger = this;
+    pthread_atfork(PrepareFork, ParentFork, ChildFork);
 }
 
 EventLogger::~EventLogger() noexcept
 {
+    if (p_Writer != NULL)
+    {
+        b_Run = false;
+        eventfd_write(i_WriterFD, 1);
+        
+        p_Writer->join();
+        delete p_Writer;
+    }
+    
+    if (i_WriterFD >= 0)
+    {
+        close(i_WriterFD);
+    }
+    
     if (f_EventLogFile.is_open() == true)
     {
+        WriteBuffer();
         f_EventLogFile.close();
     }
 }
@@ -72,363 +241,409 @@ EventLogger& EventLogger::Singleton() noexcept
     return c_EventLogger;
 }
 
+//*************************************************************************************
+// Open
+//*************************************************************************************
+
+void EventLogger::Open() noexcept
+{
+    f_EventLogFile.open(MRH_CORE_EVENT_LOG_FILE_PATH, std::ios::out | std::ios::trunc | std::ios::binary);
+    
+    if (f_EventLogFile.is_open() == false)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to open event log file: " MRH_CORE_EVENT_LOG_FILE_PATH,
+                                "EventLogger.cpp", __LINE__);
+        return;
+    }
+    
+    try
+    {
+        p_Buffer = std::unique_ptr<MRH_Uint8[]>(new MRH_Uint8[MRH_EVENT_LOGGER_BUFFER_SIZE]);
+    }
+    catch (std::exception& e)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to allocate event log buffer: " + std::string(e.what()),
+                                "EventLogger.cpp", __LINE__);
+        f_EventLogFile.close();
+        return;
+    }
+    
+    // Decoders check the header first
+    EventLogFormat::FileHeader c_Header;
+    
+    c_Header.u64_Magic = EventLogFormat::u64_Magic;
+    c_Header.u32_Version = EventLogFormat::u32_Version;
+    c_Header.u32_PayloadLimit = MRH_EVENT_LOGGER_PAYLOAD_LIMIT;
+    
+    f_EventLogFile.write(reinterpret_cast<const char*>(&c_Header), sizeof(c_Header));
+    f_EventLogFile.flush(); // Nothing left in the stream for forked children to write
+    u64_WriteTimeNS = GetTimeNS();
+    
+    // Processes started before logging was enabled keep their names
+    for (auto& Process : m_ProcessName)
+    {
+        AddProcessRecord(Process.first.first, Process.first.second, Process.second);
+    }
+    
+    // Start writer, records are still written by the next record without it
+    if ((i_WriterFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to create event log writer notification!",
+                                "EventLogger.cpp", __LINE__);
+        return;
+    }
+    
+    try
+    {
+        p_Writer = new std::thread(Update, this);
+    }
+    catch (std::exception& e)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to start event log writer: " + std::string(e.what()),
+                                "EventLogger.cpp", __LINE__);
+    }
+}
+
 //*************************************************************************************
 // Log
 //*************************************************************************************
 
-void EventLogger::LogDataLine(std::string& s_Line, const MRH_Uint8* p_Data, MRH_Uint32 u32_Bytes) noexcept
+void EventLogger::Log(Event const& c_Event, EventLogFormat::Direction e_Direction, EventLogFormat::Source e_Source, MRH_Uint32 u32_ProcessID) noexcept
 {
-    char p_Hex[32] = { '\0' };
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    
+    if (GetFiltered(c_Event, e_Direction, e_Source, u32_ProcessID) == false)
+    {
+        return;
+    }
+    
+    EventLogFormat::RecordHeader c_Header;
+    const MRH_Uint8* p_Data = c_Event.GetData();
     
-    for (MRH_Uint32 i = 0; i < u32_Bytes; ++i)
+    c_Header.u16_RecordType = EventLogFormat::RECORD_EVENT;
+    c_Header.u8_Direction = static_cast<MRH_Uint8>(e_Direction);
+    c_Header.u8_Source = static_cast<MRH_Uint8>(e_Source);
+    c_Header.u64_TimeNS = GetTimeNS();
+    c_Header.u32_ProcessID = u32_ProcessID;
+    c_Header.u32_GroupID = c_Event.GetGroupID();
+    c_Header.u32_Type = c_Event.GetType();
+    c_Header.u32_DataSize = c_Event.GetDataSize();
+    c_Header.u32_Reserved = 0;
+    
+    // Store a prefix of large event data
+    if (p_Data == NULL)
+    {
+        c_Header.u32_PayloadSize = 0;
+    }
+    else if (c_Header.u32_DataSize > MRH_EVENT_LOGGER_PAYLOAD_LIMIT)
     {
-        snprintf(p_Hex, 32, "%X", p_Data[i]); // @NOTE: Anything wrong with the loop? check this hellspawn function
-        s_Line += ("0x" + std::string(p_Hex, 2) + " ");
+        c_Header.u32_PayloadSize = MRH_EVENT_LOGGER_PAYLOAD_LIMIT;
+    }
+    else
+    {
+        c_Header.u32_PayloadSize = c_Header.u32_DataSize;
+    }
+    
+    c_Header.u64_Sequence = u64_EventID;
+    AddRecord(c_Header, p_Data);
+    
+    ++u64_EventID;
+    
+    if (MRH_EVENT_LOGGER_PRINT_CLI > 0)
+    {
+        std::cout << "- " << c_Header.u64_Sequence << ": " << EventMeta::Get(c_Header.u32_Type).p_Name << " (" << c_Header.u32_Type << ") -\n";
     }
 }
 
-void EventLogger::LogEventData(std::vector<std::string>& v_Message, const MRH_Uint8* p_Data, MRH_Uint32 u32_DataSize) noexcept
+void EventLogger::LogProcess(EventLogFormat::Source e_Source, MRH_Uint32 u32_ProcessID, std::string const& s_Name) noexcept
 {
-    MRH_Uint32 u32_Pos = 0;
-    MRH_Uint32 u32_LineBytes;
+    MRH_Uint8 u8_Source = static_cast<MRH_Uint8>(e_Source);
     
-    while (u32_Pos < u32_DataSize)
+    c_Mutex.lock();
+    
+    // Names are kept for process filters and a later opened log
+    try
+    {
+        m_ProcessName[std::make_pair(u8_Source, u32_ProcessID)] = s_Name;
+    }
+    catch (...)
+    {}
+    
+    AddProcessRecord(u8_Source, u32_ProcessID, s_Name);
+    
+    c_Mutex.unlock();
+}
+
+bool EventLogger::GetFiltered(Event const& c_Event, EventLogFormat::Direction e_Direction, EventLogFormat::Source e_Source, MRH_Uint32 u32_ProcessID) noexcept
+{
+    MRH_Uint32 u32_Type = c_Event.GetType();
+    
+    if (u32_Type < c_Filter.u32_TypeMin || u32_Type > c_Filter.u32_TypeMax)
+    {
+        return false;
+    }
+    else if ((c_Filter.u32_DirectionMask & (1 << e_Direction)) == 0 || (c_Filter.u32_SourceMask & (1 << e_Source)) == 0)
+    {
+        return false;
+    }
+    else if (c_Filter.s_Process.size() > 0)
     {
-        v_Message.emplace_back("");
-        std::string& s_Line = v_Message[v_Message.size() - 1];
+        auto Name = m_ProcessName.find(std::make_pair(static_cast<MRH_Uint8>(e_Source), u32_ProcessID));
         
-        if ((u32_LineBytes = (u32_DataSize - u32_Pos)) > 32)
+        if (Name == m_ProcessName.end() || Name->second.compare(c_Filter.s_Process) != 0)
         {
-            u32_LineBytes = 32;
+            return false;
         }
-        
-        LogDataLine(s_Line, &(p_Data[u32_Pos]), u32_LineBytes);
-        
-        u32_Pos += u32_LineBytes;
     }
+    
+    // Sample the remaining events
+    if (++u32_SampleCount < c_Filter.u32_SampleRate)
+    {
+        return false;
+    }
+    
+    u32_SampleCount = 0;
+    return true;
 }
 
-void EventLogger::Log(Event const& c_Event, std::string s_Message) noexcept
+void EventLogger::AddProcessRecord(MRH_Uint8 u8_Source, MRH_Uint32 u32_ProcessID, std::string const& s_Name) noexcept
 {
-    std::vector<std::string> v_Message;
- 
-    time_t s_RawTime;
-    time(&s_RawTime);
-    std::string s_Time(std::ctime(&s_RawTime));
-    s_Time.erase(s_Time.end() - 1); // ctime adds a newline, why?
+    EventLogFormat::RecordHeader c_Header;
     
-    v_Message.emplace_back("===");
-    v_Message.emplace_back("- " + std::to_string(u64_EventID) + ": " + GetEventNameString(c_Event.GetType()) + " -");
-    v_Message.emplace_back("Time: " + s_Time);
-    v_Message.emplace_back("Log Message: " + s_Message);
-    v_Message.emplace_back("Event Group ID: " + std::to_string(c_Event.GetGroupID()));
-    v_Message.emplace_back("Event Data Size: " + std::to_string(c_Event.GetDataSize()));
-    v_Message.emplace_back("Event Data:");
+    c_Header.u16_RecordType = EventLogFormat::RECORD_PROCESS;
+    c_Header.u8_Direction = 0;
+    c_Header.u8_Source = u8_Source;
+    c_Header.u64_TimeNS = GetTimeNS();
+    c_Header.u32_ProcessID = u32_ProcessID;
+    c_Header.u32_GroupID = 0;
+    c_Header.u32_Type = 0;
+    c_Header.u32_DataSize = static_cast<MRH_Uint32>(s_Name.size());
+    c_Header.u32_PayloadSize = (c_Header.u32_DataSize > EventLogFormat::u32_NameLimit ? EventLogFormat::u32_NameLimit : c_Header.u32_DataSize);
+    c_Header.u32_Reserved = 0;
+    c_Header.u64_Sequence = u64_EventID;
     
-    if (c_Event.GetData() != NULL && c_Event.GetDataSize() > 0)
+    AddRecord(c_Header, reinterpret_cast<const MRH_Uint8*>(s_Name.data()));
+}
+
+void EventLogger::AddRecord(EventLogFormat::RecordHeader& c_Header, const MRH_Uint8* p_Payload) noexcept
+{
+    if (p_Buffer == nullptr)
     {
-        LogEventData(v_Message, c_Event.GetData(), c_Event.GetDataSize());
+        return;
     }
-    else
+    
+    c_Header.u32_RecordSize = EventLogFormat::GetRecordSize(c_Header.u32_PayloadSize);
+    
+    if (us_BufferPos + c_Header.u32_RecordSize > MRH_EVENT_LOGGER_BUFFER_SIZE)
     {
-        v_Message.emplace_back("<No event data available>");
+        WriteBuffer();
     }
     
-    v_Message.emplace_back("===");
+    // The writer waits without timeout until a record is buffered
+    if (us_BufferPos == 0 && p_Writer != NULL)
+    {
+        eventfd_write(i_WriterFD, 1);
+    }
     
-    c_Mutex.lock();
+    MRH_Uint8* p_Record = &(p_Buffer[us_BufferPos]);
+    size_t us_Padding = c_Header.u32_RecordSize - sizeof(c_Header) - c_Header.u32_PayloadSize;
+    
+    std::memcpy(p_Record, &c_Header, sizeof(c_Header));
+    std::memcpy(p_Record + sizeof(c_Header), p_Payload, c_Header.u32_PayloadSize);
+    std::memset(p_Record + sizeof(c_Header) + c_Header.u32_PayloadSize, 0, us_Padding);
     
-    for (auto& String : v_Message)
+    us_BufferPos += c_Header.u32_RecordSize;
+    
+    // Keep the file recent on low traffic
+    if (c_Header.u64_TimeNS - u64_WriteTimeNS > u64_WriteIntervalNS)
     {
-        if (f_EventLogFile.is_open() == true)
-        {
-            f_EventLogFile << String << std::endl;
-        }
-        
-        if (MRH_EVENT_LOGGER_PRINT_CLI > 0 && String.size() > 0)
-        {
-            std::cout << String << std::endl;
-        }
+        WriteBuffer();
+    }
+}
+
+void EventLogger::WriteBuffer() noexcept
+{
+    if (us_BufferPos > 0 && f_EventLogFile.is_open() == true)
+    {
+        f_EventLogFile.write(reinterpret_cast<const char*>(p_Buffer.get()), us_BufferPos);
+        f_EventLogFile.flush();
     }
     
-    ++u64_EventID;
-    
-    c_Mutex.unlock();
+    us_BufferPos = 0;
+    u64_WriteTimeNS = GetTimeNS();
 }
 
 //*************************************************************************************
-// Getters
+// Write
 //*************************************************************************************
 
-std::string EventLogger::GetEventNameString(MRH_Uint32 u32_Type) noexcept
+void EventLogger::Update(EventLogger* p_EventLogger) noexcept
 {
-    std::string s_Result;
+    struct pollfd c_PollFD;
+    c_PollFD.fd = p_EventLogger->i_WriterFD;
+    c_PollFD.events = POLLIN;
+    
+    eventfd_t u64_Value;
+    bool b_Pending = false;
     
-    switch (u32_Type)
+    while (p_EventLogger->b_Run == true)
     {
-        /**
-         *  Event Version 1
-         */
-            
-        // Unknown
-        case MRH_EVENT_UNK:
-            s_Result = "MRH_EVENT_UNK";
-            break;
-            
-        // Permission
-        case MRH_EVENT_PERMISSION_DENIED:
-            s_Result = "MRH_EVENT_PERMISSION_DENIED";
-            break;
-            
-        // Password Required
-        case MRH_EVENT_PASSWORD_REQUIRED:
-            s_Result = "MRH_EVENT_PASSWORD_REQUIRED";
-            break;
-            
-        // Not implemented
-        case MRH_EVENT_NOT_IMPLEMENTED_S:
-            s_Result = "MRH_EVENT_NOT_IMPLEMENTED_S";
-            break;
-            
-        // Program state
-        case MRH_EVENT_PS_RESET_REQUEST_U:
-            s_Result = "MRH_EVENT_PS_RESET_REQUEST_U";
-            break;
-        case MRH_EVENT_PS_RESET_ACKNOLEDGED_U:
-            s_Result = "MRH_EVENT_PS_RESET_ACKNOLEDGED_U";
-            break;
-            
-        // Custom
-        case MRH_EVENT_CUSTOM_AVAIL_U:
-            s_Result = "MRH_EVENT_CUSTOM_AVAIL_U";
-            break;
-        case MRH_EVENT_CUSTOM_CUSTOM_COMMAND_U:
-            s_Result = "MRH_EVENT_CUSTOM_CUSTOM_COMMAND_U";
-            break;
-            
-        case MRH_EVENT_CUSTOM_AVAIL_S:
-            s_Result = "MRH_EVENT_CUSTOM_AVAIL_S";
-            break;
-        case MRH_EVENT_CUSTOM_CUSTOM_COMMAND_S:
-            s_Result = "MRH_EVENT_CUSTOM_CUSTOM_COMMAND_S";
-            break;
-            
-        // Voice - Listen
-        case MRH_EVENT_LISTEN_AVAIL_U:
-            s_Result = "MRH_EVENT_LISTEN_AVAIL_U";
-            break;
-        case MRH_EVENT_LISTEN_GET_METHOD_U:
-            s_Result = "MRH_EVENT_LISTEN_GET_METHOD_U";
-            break;
-        case MRH_EVENT_LISTEN_CUSTOM_COMMAND_U:
-            s_Result = "MRH_EVENT_LISTEN_CUSTOM_COMMAND_U";
-            break;
-            
-        case MRH_EVENT_LISTEN_AVAIL_S:
-            s_Result = "MRH_EVENT_LISTEN_AVAIL_S";
-            break;
-        case MRH_EVENT_LISTEN_STRING_S:
-            s_Result = "MRH_EVENT_LISTEN_STRING_S";
-            break;
-        case MRH_EVENT_LISTEN_GET_METHOD_S:
-            s_Result = "MRH_EVENT_LISTEN_GET_METHOD_S";
-            break;
-        case MRH_EVENT_LISTEN_CUSTOM_COMMAND_S:
-            s_Result = "MRH_EVENT_LISTEN_CUSTOM_COMMAND_S";
-            break;
-            
-        // Voice - Say
-        case MRH_EVENT_SAY_AVAIL_U:
-            s_Result = "MRH_EVENT_SAY_AVAIL_U";
-            break;
-        case MRH_EVENT_SAY_STRING_U:
-            s_Result = "MRH_EVENT_SAY_STRING_U";
-            break;
-        case MRH_EVENT_SAY_GET_METHOD_U:
-            s_Result = "MRH_EVENT_SAY_GET_METHOD_U";
-            break;
-        case MRH_EVENT_SAY_NOTIFICATION_APP_U:
-            s_Result = "MRH_EVENT_SAY_NOTIFICATION_APP_U";
-            break;
-        case MRH_EVENT_SAY_NOTIFICATION_SERVICE_U:
-            s_Result = "MRH_EVENT_SAY_NOTIFICATION_SERVICE_U";
-            break;
-        case MRH_EVENT_SAY_CUSTOM_COMMAND_U:
-            s_Result = "MRH_EVENT_SAY_CUSTOM_COMMAND_U";
-            break;
-        
-        case MRH_EVENT_SAY_AVAIL_S:
-            s_Result = "MRH_EVENT_SAY_AVAIL_S";
-            break;
-        case MRH_EVENT_SAY_STRING_S:
-            s_Result = "MRH_EVENT_SAY_STRING_S";
-            break;
-        case MRH_EVENT_SAY_GET_METHOD_S:
-            s_Result = "MRH_EVENT_SAY_GET_METHOD_S";
-            break;
-        case MRH_EVENT_SAY_NOTIFICATION_APP_S:
-            s_Result = "MRH_EVENT_SAY_NOTIFICATION_APP_S";
-            break;
-        case MRH_EVENT_SAY_CUSTOM_COMMAND_S:
-            s_Result = "MRH_EVENT_SAY_CUSTOM_COMMAND_S";
-            break;
+        // Sleep until the first record is buffered, then write it
+        // once the interval passed
+        poll(&c_PollFD, 1, b_Pending == true ? static_cast<int>(u64_WriteIntervalNS / (1000 * 1000)) : -1);
+        eventfd_read(p_EventLogger->i_WriterFD, &u64_Value);
         
-        // Password
-        case MRH_EVENT_PASSWORD_AVAIL_U:
-            s_Result = "MRH_EVENT_PASSWORD_AVAIL_U";
-            break;
-        case MRH_EVENT_PASSWORD_CHECK_U:
-            s_Result = "MRH_EVENT_PASSWORD_CHECK_U";
-            break;
-        case MRH_EVENT_PASSWORD_SET_U:
-            s_Result = "MRH_EVENT_PASSWORD_SET_U";
-            break;
-        case MRH_EVENT_PASSWORD_CUSTOM_COMMAND_U:
-            s_Result = "MRH_EVENT_PASSWORD_CUSTOM_COMMAND_U";
-            break;
+        p_EventLogger->c_Mutex.lock();
         
-        case MRH_EVENT_PASSWORD_AVAIL_S:
-            s_Result = "MRH_EVENT_PASSWORD_AVAIL_S";
-            break;
-        case MRH_EVENT_PASSWORD_CHECK_S:
-            s_Result = "MRH_EVENT_PASSWORD_CHECK_S";
-            break;
-        case MRH_EVENT_PASSWORD_SET_S:
-            s_Result = "MRH_EVENT_PASSWORD_SET_S";
-            break;
-        case MRH_EVENT_PASSWORD_CUSTOM_COMMAND_S:
-            s_Result = "MRH_EVENT_PASSWORD_CUSTOM_COMMAND_S";
-            break;
-        
-        // User
-        case MRH_EVENT_USER_AVAIL_U:
-            s_Result = "MRH_EVENT_USER_AVAIL_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_DOCUMENTS_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_DOCUMENTS_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_PICTURES_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_PICTURES_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_MUSIC_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_MUSIC_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_VIDEOS_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_VIDEOS_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_DOWNLOADS_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_DOWNLOADS_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_CLIPBOARD_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_CLIPBOARD_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_INFO_PERSON_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_INFO_PERSON_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_U";
-            break;
-        case MRH_EVENT_USER_ACCESS_CLEAR_U:
-            s_Result = "MRH_EVENT_USER_ACCESS_CLEAR_U";
-            break;
-        case MRH_EVENT_USER_GET_LOCATION_U:
-            s_Result = "MRH_EVENT_USER_GET_LOCATION_U";
-            break;
-        case MRH_EVENT_USER_CUSTOM_COMMAND_U:
-            s_Result = "MRH_EVENT_USER_CUSTOM_COMMAND_U";
-            break;
-        
-        case MRH_EVENT_USER_AVAIL_S:
-            s_Result = "MRH_EVENT_USER_AVAIL_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_DOCUMENTS_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_DOCUMENTS_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_PICTURES_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_PICTURES_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_MUSIC_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_MUSIC_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_VIDEOS_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_VIDEOS_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_DOWNLOADS_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_DOWNLOADS_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_CLIPBOARD_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_CLIPBOARD_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_INFO_PERSON_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_INFO_PERSON_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_S";
-            break;
-        case MRH_EVENT_USER_ACCESS_CLEAR_S:
-            s_Result = "MRH_EVENT_USER_ACCESS_CLEAR_S";
-            break;
-        case MRH_EVENT_USER_GET_LOCATION_S:
-            s_Result = "MRH_EVENT_USER_GET_LOCATION_S";
-            break;
-        case MRH_EVENT_USER_CUSTOM_COMMAND_S:
-            s_Result = "MRH_EVENT_USER_CUSTOM_COMMAND_S";
-            break;
+        if (b_Pending == true && p_EventLogger->us_BufferPos > 0)
+        {
+            p_EventLogger->WriteBuffer();
+        }
         
-        // Application
-        case MRH_EVENT_APP_AVAIL_U:
-            s_Result = "MRH_EVENT_APP_AVAIL_U";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_U:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_U";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_TIMER_U:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_TIMER_U";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_U:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_CLEAR_U";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_U:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_U";
-            break;
-        case MRH_EVENT_APP_CUSTOM_COMMAND_U:
-            s_Result = "MRH_EVENT_APP_CUSTOM_COMMAND_U";
-            break;
+        b_Pending = (p_EventLogger->us_BufferPos > 0);
         
-        case MRH_EVENT_APP_AVAIL_S:
-            s_Result = "MRH_EVENT_APP_AVAIL_S";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_S:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_S";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_TIMER_S:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_TIMER_S";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_TIMER_REMINDER_S:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_TIMER_REMINDER_S";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_S:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_CLEAR_S";
-            break;
-        case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_S:
-            s_Result = "MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_S";
-            break;
-        case MRH_EVENT_APP_CUSTOM_COMMAND_S:
-            s_Result = "MRH_EVENT_APP_CUSTOM_COMMAND_S";
-            break;
+        p_EventLogger->c_Mutex.unlock();
+    }
+}
+
+//*************************************************************************************
+// Fork
+//*************************************************************************************
+
+void EventLogger::PrepareFork() noexcept
+{
+    p_ForkEventLogger->c_Mutex.lock();
+}
+
+void EventLogger::ParentFork() noexcept
+{
+    p_ForkEventLogger->c_Mutex.unlock();
+}
+
+void EventLogger::ChildFork() noexcept
+{
+    // The writer thread does not exist in the child and the
+    // buffered records belong to the parent
+    p_ForkEventLogger->p_Writer = NULL;
+    p_ForkEventLogger->us_BufferPos = 0;
+    
+    p_ForkEventLogger->c_Mutex.unlock();
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void EventLogger::UpdateFilter() noexcept
+{
+    Logger& c_Logger = Logger::Singleton();
+    struct stat c_Stat;
+    
+    Filter c_Read;
+    c_Read.u32_TypeMin = 0;
+    c_Read.u32_TypeMax = 0xFFFFFFFF;
+    c_Read.u32_SourceMask = 0xFFFFFFFF;
+    c_Read.u32_DirectionMask = 0xFFFFFFFF;
+    c_Read.s_Process = "";
+    c_Read.u32_SampleRate = 1;
+    
+    bool b_Enable;
+    
+    if (stat(MRH_CORE_EVENT_LOG_CONTROL_FILE_PATH, &c_Stat) != 0)
+    {
+        // No control file, use the build default
+        b_Enable = (MRH_CORE_EVENT_LOGGING > 0);
+    }
+    else
+    {
+        try
+        {
+            MRH_BlockFile c_File(MRH_CORE_EVENT_LOG_CONTROL_FILE_PATH);
+            std::string s_Value;
             
-        /**
-         *  Unk
-         */
+            // Control file exists, so logging is wanted unless disabled
+            b_Enable = true;
             
-        default:
-            s_Result = "UNKNOWN EVENT";
-            break;
+            for (auto& Block : c_File.l_Block)
+            {
+                if (Block.GetName().compare(p_Identifier[BLOCK_EVENT_LOG]) != 0)
+                {
+                    continue;
+                }
+                
+                if ((s_Value = GetOptionalValue(Block, p_Identifier[ENABLED])).size() > 0)
+                {
+                    b_Enable = (std::stoi(s_Value) > 0);
+                }
+                
+                if ((s_Value = GetOptionalValue(Block, p_Identifier[TYPE_MIN])).size() > 0)
+                {
+                    c_Read.u32_TypeMin = static_cast<MRH_Uint32>(std::stoull(s_Value));
+                }
+                
+                if ((s_Value = GetOptionalValue(Block, p_Identifier[TYPE_MAX])).size() > 0)
+                {
+                    c_Read.u32_TypeMax = static_cast<MRH_Uint32>(std::stoull(s_Value));
+                }
+                
+                if ((s_Value = GetOptionalValue(Block, p_Identifier[SOURCE])).size() > 0)
+                {
+                    c_Read.u32_SourceMask = ParseMask(s_Value, SOURCE_USER, EventLogFormat::SOURCE_COUNT);
+                }
+                
+                if ((s_Value = GetOptionalValue(Block, p_Identifier[DIRECTION])).size() > 0)
+                {
+                    c_Read.u32_DirectionMask = ParseMask(s_Value, DIRECTION_RECIEVED, EventLogFormat::DIRECTION_COUNT);
+                }
+                
+                c_Read.s_Process = GetOptionalValue(Block, p_Identifier[PROCESS]);
+                
+                if ((s_Value = GetOptionalValue(Block, p_Identifier[SAMPLE_RATE])).size() > 0)
+                {
+                    c_Read.u32_SampleRate = static_cast<MRH_Uint32>(std::stoull(s_Value));
+                }
+            }
+        }
+        catch (std::exception& e)
+        {
+            c_Logger.Log(Logger::WARNING, "Failed to read event log control file " MRH_CORE_EVENT_LOG_CONTROL_FILE_PATH ": " +
+                                          std::string(e.what()) +
+                                          " Keeping the current event log filter.",
+                         "EventLogger.cpp", __LINE__);
+            return;
+        }
     }
     
-    s_Result += " (";
-    s_Result += std::to_string(u32_Type);
-    s_Result += ")";
+    c_Mutex.lock();
+    
+    c_Filter = c_Read;
+    u32_SampleCount = 0;
+    
+    // The log file is created on the first enable, never while disabled
+    if (b_Enable == true && f_EventLogFile.is_open() == false)
+    {
+        Open();
+    }
+    
+    c_Mutex.unlock();
     
-    return s_Result;
+    b_Enabled.store(b_Enable, std::memory_order_relaxed);
+    
+    if (b_Enable == true)
+    {
+        c_Logger.Log(Logger::INFO, "Event logging enabled (Types " +
+                                   std::to_string(c_Read.u32_TypeMin) +
+                                   " - " +
+                                   std::to_string(c_Read.u32_TypeMax) +
+                                   ", 1 in " +
+                                   std::to_string(c_Read.u32_SampleRate) +
+                                   (c_Read.s_Process.size() > 0 ? ", process " + c_Read.s_Process : "") +
+                                   ").",
+                     "EventLogger.cpp", __LINE__);
+    }
+    else
+    {
+        c_Logger.Log(Logger::INFO, "Event logging disabled.",
+                     "EventLogger.cpp", __LINE__);
+    }
 }
@@ -19,12 +19,17 @@
 
 // C / C++
 #include <mutex>
+#include <atomic>
+#include <thread>
 #include <fstream>
 #include <string>
+#include <memory>
+#include <map>
 
 // External
 
 // Project
+#include "./EventLogFormat.h"
 #include "../Event/Event.h"
 
 
@@ -32,22 +37,6 @@ class EventLogger
 {
 public:
     
-    //*************************************************************************************
-    // Types
-    //*************************************************************************************
-    
-    typedef enum
-    {
-        USER = 0,
-        USER_SERVICE = 1,
-        PLATFORM_SERVICE = 2,
-        
-        EVENT_SOURCE_MAX = PLATFORM_SERVICE,
-        
-        EVENT_SOURCE_COUNT = EVENT_SOURCE_MAX + 1
-        
-    }EventSource;
-
     //*************************************************************************************
     // Singleton
     //*************************************************************************************
@@ -68,13 +57,67 @@ public:
      *  Log an event. This function is thread safe.
      *
      *  \param c_Event The event to log.
-     *  \param s_Message The message describing the event.
+     *  \param e_Direction The direction of the event.
+     *  \param e_Source The process type which recieved or sends the event.
+     *  \param u32_ProcessID The process which recieved or sends the event.
      */
     
-    void Log(Event const& c_Event, std::string s_Message) noexcept;
+    void Log(Event const& c_Event, EventLogFormat::Direction e_Direction, EventLogFormat::Source e_Source, MRH_Uint32 u32_ProcessID) noexcept;
+    
+    /**
+     *  Log the name of a process. Events logged afterwards for the process
+     *  use this name. This function is thread safe.
+     *
+     *  \param e_Source The process type.
+     *  \param u32_ProcessID The process id.
+     *  \param s_Name The process name.
+     */
     
+    void LogProcess(EventLogFormat::Source e_Source, MRH_Uint32 u32_ProcessID, std::string const& s_Name) noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Read the event log control file and replace the active filter. Event
+     *  logging is reset to the build default if no control file exists.
+     */
+    
+    void UpdateFilter() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if event logging is enabled. This function is thread safe.
+     *
+     *
+eturn true if events should be logged, false if not.
+     */
+    
+    static inline bool GetEnabled() noexcept
+    {
+        return b_Enabled.load(std::memory_order_relaxed);
+    }
+
 private:
     
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Filter
+    {
+        MRH_Uint32 u32_TypeMin;
+        MRH_Uint32 u32_TypeMax;
+        MRH_Uint32 u32_SourceMask;               // Bit per EventLogFormat::Source
+        MRH_Uint32 u32_DirectionMask;            // Bit per EventLogFormat::Direction
+        std::string s_Process;                   // Logged process name, empty for all
+        MRH_Uint32 u32_SampleRate;               // Log 1 in N matching events
+    };
+    
     //*************************************************************************************
     // Constructor / Destructor
     //*************************************************************************************
@@ -91,43 +134,92 @@ private:
     
     ~EventLogger() noexcept;
     
+    //*************************************************************************************
+    // Open
+    //*************************************************************************************
+    
+    /**
+     *  Open the event log file and start the writer. The mutex has to be
+     *  locked.
+     */
+    
+    void Open() noexcept;
+    
     //*************************************************************************************
     // Log
     //*************************************************************************************
-     
+    
     /**
-     *  Log a line of the event data buffer.
+     *  Check if an event passes the active filter. The mutex has to be locked.
+     *
+     *  \param c_Event The event to check.
+     *  \param e_Direction The direction of the event.
+     *  \param e_Source The process type which recieved or sends the event.
+     *  \param u32_ProcessID The process which recieved or sends the event.
      *
-     *  \param s_Line The line string to write to.
-     *  \param p_Data The start of the event data to log.
-     *  \param u32_Bytes The amount of bytes to log
+     *  \return true if the event should be logged, false if not.
      */
-     
-    void LogDataLine(std::string& s_Line, const MRH_Uint8* p_Data, MRH_Uint32 u32_Bytes) noexcept;
+    
+    bool GetFiltered(Event const& c_Event, EventLogFormat::Direction e_Direction, EventLogFormat::Source e_Source, MRH_Uint32 u32_ProcessID) noexcept;
     
     /**
-     *  Log an event data buffer.
+     *  Add a process name record to the log buffer. The mutex has to be locked.
      *
-     *  \param v_Message The message vector to append to.
-     *  \param p_Data The event data to log.
-     *  \param u32_DataSize The total event data size.
+     *  \param u8_Source The process type.
+     *  \param u32_ProcessID The process id.
+     *  \param s_Name The process name.
      */
     
-    void LogEventData(std::vector<std::string>& v_Message, const MRH_Uint8* p_Data, MRH_Uint32 u32_DataSize) noexcept;
+    void AddProcessRecord(MRH_Uint8 u8_Source, MRH_Uint32 u32_ProcessID, std::string const& s_Name) noexcept;
+    
+    /**
+     *  Add a record to the log buffer.
+     *
+     *  \param c_Header The record header. The record size is set by this function.
+     *  \param p_Payload The record payload.
+     */
+    
+    void AddRecord(EventLogFormat::RecordHeader& c_Header, const MRH_Uint8* p_Payload) noexcept;
+    
+    /**
+     *  Write the log buffer to the log file.
+     */
+    
+    void WriteBuffer() noexcept;
     
     //*************************************************************************************
-    // Getters
+    // Write
     //*************************************************************************************
     
     /**
-     *  Get the event name string. This function is thread safe.
-     *
-     *  \param u32_Type The event type.
+     *  Write buffered records once per write interval until stopped.
      *
-     *  \return The event name string.
+     *  \param p_EventLogger The event logger to write for.
      */
     
-    std::string GetEventNameString(MRH_Uint32 u32_Type) noexcept;
+    static void Update(EventLogger* p_EventLogger) noexcept;
+    
+    //*************************************************************************************
+    // Fork
+    //*************************************************************************************
+    
+    /**
+     *  Lock the event logger before a fork.
+     */
+    
+    static void PrepareFork() noexcept;
+    
+    /**
+     *  Unlock the event logger in the parent after a fork.
+     */
+    
+    static void ParentFork() noexcept;
+    
+    /**
+     *  Unlock the event logger in the child after a fork.
+     */
+    
+    static void ChildFork() noexcept;
     
     //*************************************************************************************
     // Data
@@ -137,8 +229,24 @@ private:
     
     std::ofstream f_EventLogFile;
     
+    // Records are buffered and written in blocks
+    std::unique_ptr<MRH_Uint8[]> p_Buffer;
+    size_t us_BufferPos;
+    MRH_Uint64 u64_WriteTimeNS;
+    
+    // Buffer writer, writes records at most one interval after they were added
+    std::thread* p_Writer;
+    int i_WriterFD;
+    std::atomic<bool> b_Run;
+    
     MRH_Uint64 u64_EventID; // The id is defined by the amount sent, first event 0, second 1, etc...
     
+    // Runtime selection, checked before any logging work is done
+    static std::atomic<bool> b_Enabled;
+    Filter c_Filter;
+    MRH_Uint32 u32_SampleCount;
+    std::map<std::pair<MRH_Uint8, MRH_Uint32>, std::string> m_ProcessName;
+
 protected:
     
 };
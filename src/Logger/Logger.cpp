@@ -16,9 +16,14 @@
 
 // C / C++
 #include <execinfo.h>
+#include <sys/eventfd.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <poll.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <cerrno>
 #include <iostream>
 #include <ctime>
 
@@ -40,18 +45,65 @@
 #ifndef MRH_LOGGER_LINE_LIMIT
     #define MRH_LOGGER_LINE_LIMIT 1000
 #endif
+#ifndef MRH_LOGGER_RING_SIZE
+    #define MRH_LOGGER_RING_SIZE 256
+#endif
+#ifndef MRH_LOGGER_FLUSH_INTERVAL_MS
+    #define MRH_LOGGER_FLUSH_INTERVAL_MS 250
+#endif
+#ifndef MRH_LOGGER_DROP_POLICY
+    #define MRH_LOGGER_DROP_POLICY 0
+#endif
+
+namespace
+{
+    // Used by fork handlers, which might run during singleton creation
+    Logger* p_ForkLogger = NULL;
+    
+    void WriteFile(int i_FD, std::string const& s_Data) noexcept
+    {
+        size_t us_Pos = 0;
+        ssize_t ss_Write;
+        
+        while (us_Pos < s_Data.size())
+        {
+            if ((ss_Write = write(i_FD, s_Data.data() + us_Pos, s_Data.size() - us_Pos)) > 0)
+            {
+                us_Pos += ss_Write;
+            }
+            else if (ss_Write < 0 && errno != EINTR)
+            {
+                return;
+            }
+        }
+    }
+}
 
 
 //*************************************************************************************
 // Constructor / Destructor
 //*************************************************************************************
 
-Logger::Logger() noexcept : us_Lines(0)
+Logger::Logger() noexcept : i_LogFD(-1),
+                            us_Lines(0),
+                            p_Writer(NULL),
+                            i_WriterFD(-1),
+                            b_Async(false),
+                            b_Run(true),
+                            b_Flush(false),
+                            us_DroppedReported(0),
+                            us_Written(0)
 {
-    f_LogFile.open(MRH_CORE_LOG_FILE_PATH, std::ios::out | std::ios::trunc);
+    for (size_t i = 0; i < LOG_LEVEL_COUNT; ++i)
+    {
+        p_Dropped[i] = 0;
+    }
+    
+    // Appending keeps concurrent writes and truncation consistent
+    i_LogFD = open(MRH_CORE_LOG_FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0666);
     f_BacktraceFile.open(MRH_CORE_BACKTRACE_FILE_PATH, std::ios::out | std::ios::trunc);
     
-    if (f_LogFile.is_open() == false)
+    if (i_LogFD < 0)
     {
         Log(Logger::WARNING, "Failed to open log file: " MRH_CORE_LOG_FILE_PATH,
             "Logger.cpp", __LINE__);
@@ -62,13 +114,63 @@ Logger::Logger() noexcept : us_Lines(0)
         Log(Logger::WARNING, "Failed to open backtrace file: " MRH_CORE_LOG_FILE_PATH,
             "Logger.cpp", __LINE__);
     }
+    
+    // Forked children have no log writer
+    p_ForkLogger = this;
+    pthread_atfork(PrepareFork, ParentFork, ChildFork);
+    
+    // Start writer, logging is direct until the writer runs
+    // @NOTE: No condition variable, forked children could not destroy it
+    if ((i_WriterFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+    {
+        Log(Logger::WARNING, "Failed to create log writer notification!",
+            "Logger.cpp", __LINE__);
+        return;
+    }
+    
+    try
+    {
+        p_Writer = new std::thread(Update, this);
+        b_Async = true;
+    }
+    catch (std::exception& e)
+    {
+        Log(Logger::WARNING, "Failed to start log writer: " + std::string(e.what()),
+            "Logger.cpp", __LINE__);
+    }
 }
 
 Logger::~Logger() noexcept
 {
-    if (f_LogFile.is_open() == true)
+    // Log directly from now on, the writer writes the remaining records
+    b_Async = false;
+    
+    if (p_Writer != NULL)
     {
-        f_LogFile.close();
+        b_Run = false;
+        eventfd_write(i_WriterFD, 1);
+        
+        // Exit called by the writer itself (signal)?
+        if (p_Writer->get_id() == std::this_thread::get_id())
+        {
+            p_Writer->detach();
+        }
+        else
+        {
+            p_Writer->join();
+        }
+        
+        delete p_Writer;
+    }
+    
+    if (i_WriterFD >= 0)
+    {
+        close(i_WriterFD);
+    }
+    
+    if (i_LogFD >= 0)
+    {
+        close(i_LogFD);
     }
     
     if (f_BacktraceFile.is_open() == true)
@@ -77,6 +179,35 @@ Logger::~Logger() noexcept
     }
 }
 
+Logger::Ring::Ring(size_t us_Size) : us_Mask(1),
+                                     us_Tail(0),
+                                     us_Head(0),
+                                     b_Used(false)
+{
+    // Round to power of two for masking
+    while (us_Mask < us_Size)
+    {
+        us_Mask <<= 1;
+    }
+    
+    p_Record = std::unique_ptr<Record[]>(new Record[us_Mask]);
+    us_Mask -= 1;
+}
+
+Logger::ThreadRing::ThreadRing() noexcept : p_Ring(NULL)
+{}
+
+Logger::ThreadRing::~ThreadRing() noexcept
+{
+    // Thread exited, ring can be reused once written
+    if (p_Ring != NULL)
+    {
+        p_Ring->b_Used.store(false, std::memory_order_release);
+    }
+}
+
+thread_local Logger::ThreadRing Logger::c_ThreadRing;
+
 //*************************************************************************************
 // Singleton
 //*************************************************************************************
@@ -93,38 +224,298 @@ Logger& Logger::Singleton() noexcept
 
 void Logger::Log(LogLevel e_Level, std::string s_Message, std::string s_File, size_t us_Line) noexcept
 {
-    c_Mutex.lock();
+    Ring* p_Ring = NULL;
     
-    // Reopen with truncate?
-    if (us_Lines == MRH_LOGGER_LINE_LIMIT)
+    if (b_Async == true)
     {
-        f_LogFile.close();
-        f_LogFile.open(MRH_CORE_LOG_FILE_PATH, std::ios::out | std::ios::trunc);
+        p_Ring = GetRing();
+    }
+    
+    if (p_Ring != NULL)
+    {
+        size_t us_Tail = p_Ring->us_Tail.load(std::memory_order_relaxed);
+        size_t us_Head = p_Ring->us_Head.load(std::memory_order_acquire);
         
-        if (f_LogFile.is_open() == true)
+        // Ring full?
+        // @NOTE: Errors are never dropped
+        while (us_Tail - us_Head > p_Ring->us_Mask && b_Async == true)
         {
-            f_LogFile << "[Logger.cpp][" << __LINE__ << "][INFO]: Truncated log file." << std::endl;
-            us_Lines = 0;
+            if (MRH_LOGGER_DROP_POLICY == 0 && e_Level != ERROR)
+            {
+                p_Dropped[e_Level] += 1;
+                return;
+            }
+            
+            RequestWrite();
+            std::this_thread::yield();
+            
+            us_Head = p_Ring->us_Head.load(std::memory_order_acquire);
+        }
+        
+        if (us_Tail - us_Head <= p_Ring->us_Mask)
+        {
+            // Swap, the old buffers are released by the writer
+            Record& c_Record = p_Ring->p_Record[us_Tail & p_Ring->us_Mask];
+            
+            c_Record.e_Level = e_Level;
+            c_Record.us_Line = us_Line;
+            c_Record.s_File.swap(s_File);
+            c_Record.s_Message.swap(s_Message);
+            
+            p_Ring->us_Tail.store(us_Tail + 1, std::memory_order_release);
+            
+            // Errors are written at once, filling rings early
+            if (e_Level == ERROR || us_Tail + 1 - us_Head == (p_Ring->us_Mask + 1) / 2)
+            {
+                RequestWrite();
+            }
+            
+            return;
         }
     }
-    else
+    
+    // No writer or thread ring, write directly
+    std::string s_Line;
+    
+    FormatLine(s_Line, e_Level, s_Message, s_File, us_Line);
+    WriteLines(s_Line, 1);
+}
+
+void Logger::LogStatistics() noexcept
+{
+    size_t us_Rings;
+    
+    c_RingMutex.lock();
+    us_Rings = v_Ring.size();
+    c_RingMutex.unlock();
+    
+    Log(Logger::INFO, "Log records: Written " +
+                      std::to_string(us_Written) +
+                      ", dropped " +
+                      std::to_string(p_Dropped[INFO]) +
+                      " info and " +
+                      std::to_string(p_Dropped[WARNING]) +
+                      " warning, " +
+                      std::to_string(us_Rings) +
+                      " thread queues of " +
+                      std::to_string(MRH_LOGGER_RING_SIZE) +
+                      " records.",
+        "Logger.cpp", __LINE__);
+}
+
+//*************************************************************************************
+// Ring
+//*************************************************************************************
+
+Logger::Ring* Logger::GetRing() noexcept
+{
+    if (c_ThreadRing.p_Ring != NULL)
     {
-        // Limit not reached, add
-        us_Lines += 1;
+        return c_ThreadRing.p_Ring;
     }
     
-    // Now write
-    if (f_LogFile.is_open() == true)
+    std::lock_guard<std::mutex> c_Guard(c_RingMutex);
+    
+    // Reuse the ring of a exited thread
+    for (auto& Entry : v_Ring)
     {
-        f_LogFile << "[" << s_File << "][" << std::to_string(us_Line) << "][" << GetLevelString(e_Level) << "]: " << s_Message << std::endl;
+        if (Entry->b_Used.load(std::memory_order_acquire) == false)
+        {
+            Entry->b_Used = true;
+            c_ThreadRing.p_Ring = Entry.get();
+            
+            return c_ThreadRing.p_Ring;
+        }
     }
     
-    if (MRH_LOGGER_PRINT_CLI > 0)
+    try
     {
-        std::cout << "[" << s_File << "][" << std::to_string(us_Line) << "][" << GetLevelString(e_Level) << "]: " << s_Message << std::endl;
+        std::unique_ptr<Ring> p_Ring(new Ring(MRH_LOGGER_RING_SIZE));
+        
+        p_Ring->b_Used = true;
+        v_Ring.emplace_back(std::move(p_Ring));
+    }
+    catch (...)
+    {
+        // Write directly instead
+        return NULL;
+    }
+    
+    c_ThreadRing.p_Ring = v_Ring.back().get();
+    return c_ThreadRing.p_Ring;
+}
+
+//*************************************************************************************
+// Write
+//*************************************************************************************
+
+void Logger::Update(Logger* p_Logger) noexcept
+{
+    struct pollfd c_PollFD;
+    c_PollFD.fd = p_Logger->i_WriterFD;
+    c_PollFD.events = POLLIN;
+    
+    eventfd_t u64_Value;
+    
+    while (p_Logger->b_Run == true)
+    {
+        // Write on interval or when requested
+        poll(&c_PollFD, 1, MRH_LOGGER_FLUSH_INTERVAL_MS);
+        
+        // Reset before allowing new requests
+        eventfd_read(p_Logger->i_WriterFD, &u64_Value);
+        p_Logger->b_Flush = false;
+        
+        p_Logger->WriteRecords();
     }
     
+    // Write remaining records on exit
+    p_Logger->WriteRecords();
+}
+
+size_t Logger::WriteRecords() noexcept
+{
+    size_t us_Count = 0;
+    size_t us_Rings;
+    size_t us_Dropped = 0;
+    
+    // Rings are only added, never removed
+    c_RingMutex.lock();
+    us_Rings = v_Ring.size();
+    c_RingMutex.unlock();
+    
+    // Lines are collected first, the file is written once per call
+    s_WriterLines.clear();
+    
+    for (size_t i = 0; i < us_Rings; ++i)
+    {
+        c_RingMutex.lock();
+        Ring& c_Ring = *(v_Ring[i]);
+        c_RingMutex.unlock();
+        
+        size_t us_Head = c_Ring.us_Head.load(std::memory_order_relaxed);
+        size_t us_Tail = c_Ring.us_Tail.load(std::memory_order_acquire);
+        
+        for (; us_Head != us_Tail; ++us_Head)
+        {
+            Record& c_Record = c_Ring.p_Record[us_Head & c_Ring.us_Mask];
+            
+            FormatLine(s_WriterLines, c_Record.e_Level, c_Record.s_Message, c_Record.s_File, c_Record.us_Line);
+            
+            // Release here instead of the producer
+            std::string().swap(c_Record.s_Message);
+            std::string().swap(c_Record.s_File);
+            
+            ++us_Count;
+        }
+        
+        c_Ring.us_Head.store(us_Head, std::memory_order_release);
+    }
+    
+    // Report records dropped since the last write
+    for (size_t i = 0; i < LOG_LEVEL_COUNT; ++i)
+    {
+        us_Dropped += p_Dropped[i];
+    }
+    
+    if (us_Dropped != us_DroppedReported)
+    {
+        FormatLine(s_WriterLines, Logger::WARNING, "Dropped " +
+                                                   std::to_string(us_Dropped - us_DroppedReported) +
+                                                   " log records, thread log queue full!",
+                   "Logger.cpp", __LINE__);
+        
+        us_DroppedReported = us_Dropped;
+        ++us_Count;
+    }
+    
+    if (us_Count > 0)
+    {
+        WriteLines(s_WriterLines, us_Count);
+    }
+    
+    us_Written += us_Count;
+    return us_Count;
+}
+
+void Logger::FormatLine(std::string& s_Lines, LogLevel e_Level, std::string const& s_Message, std::string const& s_File, size_t us_Line) noexcept
+{
+    try
+    {
+        s_Lines.append("[").append(s_File)
+               .append("][").append(std::to_string(us_Line))
+               .append("][").append(GetLevelString(e_Level))
+               .append("]: ").append(s_Message)
+               .append(1, '\n');
+    }
+    catch (...)
+    {}
+}
+
+void Logger::WriteLines(std::string const& s_Lines, size_t us_Count) noexcept
+{
+    bool b_Truncated = false;
+    
+    // Truncate with the limit reached, appended writes restart at the beginning
+    c_Mutex.lock();
+    
+    if (us_Lines + us_Count > MRH_LOGGER_LINE_LIMIT && i_LogFD >= 0 && ftruncate(i_LogFD, 0) == 0)
+    {
+        us_Lines = 0;
+        b_Truncated = true;
+    }
+    
+    us_Lines += us_Count;
+    
     c_Mutex.unlock();
+    
+    // Write without the lock, a fork never waits for the disk
+    if (i_LogFD >= 0)
+    {
+        if (b_Truncated == true)
+        {
+            WriteFile(i_LogFD, "[Logger.cpp][" + std::to_string(__LINE__) + "][INFO]: Truncated log file.\n");
+        }
+        
+        WriteFile(i_LogFD, s_Lines);
+    }
+    
+    if (MRH_LOGGER_PRINT_CLI > 0)
+    {
+        std::cout << s_Lines << std::flush;
+    }
+}
+
+void Logger::RequestWrite() noexcept
+{
+    // Only request once until the writer woke up
+    if (b_Flush.exchange(true) == false)
+    {
+        eventfd_write(i_WriterFD, 1);
+    }
+}
+
+//*************************************************************************************
+// Fork
+//*************************************************************************************
+
+void Logger::PrepareFork() noexcept
+{
+    p_ForkLogger->c_Mutex.lock();
+}
+
+void Logger::ParentFork() noexcept
+{
+    p_ForkLogger->c_Mutex.unlock();
+}
+
+void Logger::ChildFork() noexcept
+{
+    // The writer thread does not exist in the child
+    p_ForkLogger->b_Async = false;
+    p_ForkLogger->p_Writer = NULL;
+    
+    p_ForkLogger->c_Mutex.unlock();
 }
 
 //*************************************************************************************
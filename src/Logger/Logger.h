@@ -18,6 +18,10 @@
 #define Logger_h
 
 // C / C++
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <vector>
 #include <mutex>
 #include <fstream>
 #include <string>
@@ -64,7 +68,8 @@ public:
     //*************************************************************************************
     
     /**
-     *  Log a message. This function is thread safe.
+     *  Log a message. The message is queued and written by the log writer.
+     *  This function is thread safe.
      *
      *  \param e_Level The log level of this message.
      *  \param s_Message The message to log.
@@ -74,6 +79,12 @@ public:
     
     void Log(LogLevel e_Level, std::string s_Message, std::string s_File, size_t us_Line) noexcept;
     
+    /**
+     *  Log the queued message statistics. This function is thread safe.
+     */
+    
+    void LogStatistics() noexcept;
+    
     //*************************************************************************************
     // Backtrace
     //*************************************************************************************
@@ -105,6 +116,125 @@ private:
     
     ~Logger() noexcept;
     
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Record
+    {
+        LogLevel e_Level;
+        size_t us_Line;
+        std::string s_File;
+        std::string s_Message;
+    };
+    
+    struct Ring
+    {
+        Ring(size_t us_Size);
+        
+        std::unique_ptr<Record[]> p_Record;
+        size_t us_Mask;
+        
+        // Producer and writer positions, padded to avoid false sharing
+        std::atomic<size_t> us_Tail;
+        char p_TailPadding[64 - sizeof(std::atomic<size_t>)];
+        std::atomic<size_t> us_Head;
+        char p_HeadPadding[64 - sizeof(std::atomic<size_t>)];
+        
+        // Owned by a running thread
+        std::atomic<bool> b_Used;
+    };
+    
+    struct ThreadRing
+    {
+        ThreadRing() noexcept;
+        ~ThreadRing() noexcept;
+        
+        Ring* p_Ring;
+    };
+    
+    //*************************************************************************************
+    // Ring
+    //*************************************************************************************
+    
+    /**
+     *  Get the ring of the calling thread. This function is thread safe.
+     *
+     *  \return The thread ring on success, NULL on failure.
+     */
+    
+    Ring* GetRing() noexcept;
+    
+    //*************************************************************************************
+    // Write
+    //*************************************************************************************
+    
+    /**
+     *  Write queued records.
+     *
+     *  \param p_Logger The logger to write records for.
+     */
+    
+    static void Update(Logger* p_Logger) noexcept;
+    
+    /**
+     *  Write all records queued in the thread rings.
+     *
+     *  \return The amount of records written.
+     */
+    
+    size_t WriteRecords() noexcept;
+    
+    /**
+     *  Add a log line to a line buffer.
+     *
+     *  \param s_Lines The line buffer to add to.
+     *  \param e_Level The log level of this message.
+     *  \param s_Message The message to log.
+     *  \param s_File The source file this log was created from.
+     *  \param us_Line The source file line this log was created from.
+     */
+    
+    void FormatLine(std::string& s_Lines, LogLevel e_Level, std::string const& s_Message, std::string const& s_File, size_t us_Line) noexcept;
+    
+    /**
+     *  Write log lines to the log file. This function is thread safe.
+     *
+     *  \param s_Lines The lines to write.
+     *  \param us_Count The amount of lines.
+     */
+    
+    void WriteLines(std::string const& s_Lines, size_t us_Count) noexcept;
+    
+    /**
+     *  Wake the log writer to write queued records. This function is thread safe.
+     */
+    
+    void RequestWrite() noexcept;
+    
+    //*************************************************************************************
+    // Fork
+    //*************************************************************************************
+    
+    /**
+     *  Lock the log line count before forking.
+     */
+    
+    static void PrepareFork() noexcept;
+    
+    /**
+     *  Unlock the log line count in the parent after forking.
+     */
+    
+    static void ParentFork() noexcept;
+    
+    /**
+     *  Unlock the log line count in the child after forking and write
+     *  directly, the child has no log writer.
+     */
+    
+    static void ChildFork() noexcept;
+    
     //*************************************************************************************
     // Backtrace
     //*************************************************************************************
@@ -136,13 +266,32 @@ private:
     // Data
     //*************************************************************************************
     
+    // Log file, appended without holding the mutex
+    // @NOTE: The mutex only guards the line count and truncation
     std::mutex c_Mutex;
+    int i_LogFD;
+    size_t us_Lines;
     
-    std::ofstream f_LogFile;
     std::ofstream f_BacktraceFile;
     
-    size_t us_Lines;
+    // Thread rings, kept for reuse after a thread exits
+    std::mutex c_RingMutex;
+    std::vector<std::unique_ptr<Ring>> v_Ring;
+    static thread_local ThreadRing c_ThreadRing;
     
+    // Log writer, lines are collected before writing
+    std::thread* p_Writer;
+    std::string s_WriterLines;
+    int i_WriterFD;
+    std::atomic<bool> b_Async;
+    std::atomic<bool> b_Run;
+    std::atomic<bool> b_Flush;
+    
+    // Statistics
+    std::atomic<size_t> p_Dropped[LOG_LEVEL_COUNT];
+    size_t us_DroppedReported;
+    std::atomic<size_t> us_Written;
+
 protected:
     
 };
@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <new>
 #include <clocale>
+#include <algorithm>
 
 // External
 
@@ -29,8 +30,13 @@
 #include "./Process/User/UserProcess.h"
 #include "./InputHandler/InputHandler.h"
 #include "./Package/PackageContainer.h"
+#include "./Event/EventAllocator.h"
+#include "./Event/EventLane.h"
+#include "./Event/EventTrace.h"
 #include "./Configuration/ConfigurationFiles.h"
 #include "./Logger/Logger.h"
+#include "./Logger/EventLogger.h"
+#include "./MainLoop.h"
 #include "./Timer.h"
 #include "./FilePaths.h"
 #include "./Revision.h"
@@ -76,6 +82,7 @@ extern "C"
             case SIGTERM:
             case SIGHUP:
             case SIGINT:
+            case SIGUSR1:
                 i_LastSignal = i_Signal;
                 break;
                 
@@ -326,6 +333,7 @@ int main(int argc, char* argv[])
     std::signal(SIGSEGV, SignalHandler);
     std::signal(SIGINT, SignalHandler);
     std::signal(SIGHUP, SignalHandler);
+    std::signal(SIGUSR1, SignalHandler);
     
     // Create run directories
     CreateDirectory(MRH_CORE_PID_FILE_DIR);
@@ -337,20 +345,25 @@ int main(int argc, char* argv[])
     SetLocale();
     LoadStaticConfiguration();
     LoadVariableConfiguration();
+    EventLogger::Singleton().UpdateFilter();
     
     // Now create the required components
-    UserProcess* p_UserProcess;
-    UserServicePool* p_UserPool;
-    PlatformServicePool* p_PlatformPool;
-    InputHandler* p_Input;
+    UserProcess* p_UserProcess = NULL;
+    UserServicePool* p_UserPool = NULL;
+    PlatformServicePool* p_PlatformPool = NULL;
+    InputHandler* p_Input = NULL;
+    MainLoop* p_Loop = NULL;
     CoreConfiguration& c_CoreConfiguration = CoreConfiguration::Singleton();
     bool b_ComponentFailed = true;
     
     try
     {
+        // @NOTE: Created first, signals have to be blocked before the pools create threads!
+        p_Loop = new MainLoop();
+        
         // @NOTE: Platform and user pool start on construction!
         p_PlatformPool = new PlatformServicePool();
-        p_UserPool = new UserServicePool();
+        p_UserPool = new UserServicePool(p_PlatformPool); // Forwards to platform services
         p_UserProcess = new UserProcess();
         p_Input = new InputHandler();
         
@@ -384,14 +397,20 @@ int main(int argc, char* argv[])
                      "Main.cpp", __LINE__);
         
         // Delete the two components which have child processes to kill the children
+        // @NOTE: The user pool forwards to the platform pool, delete first
+        if (p_UserPool != NULL)
+        {
+            delete p_UserPool;
+        }
+        
         if (p_PlatformPool != NULL)
         {
             delete p_PlatformPool;
         }
         
-        if (p_UserPool != NULL)
+        if (p_Loop != NULL)
         {
-            delete p_UserPool;
+            delete p_Loop;
         }
         
         return EXIT_FAILURE;
@@ -414,11 +433,31 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             
-            std::this_thread::sleep_for(std::chrono::milliseconds(c_CoreConfiguration.GetWaitSleepTimerMS()));
+            // Sleep, but still react to signals
+            p_Loop->Wait(c_CoreConfiguration.GetWaitSleepTimerMS());
+            
+            if (p_Loop->GetReady(MainLoop::SIGNAL) == true)
+            {
+                int i_Signal = p_Loop->ReadSignal();
+                
+                if (i_Signal != -1)
+                {
+                    i_LastSignal = i_Signal;
+                }
+            }
         }
     }
     
     // Continious loop until termination request
+    PoolCondition& c_PlatformCondition = p_PlatformPool->GetRecievedCondition();
+    PoolCondition& c_UserCondition = p_UserPool->GetRecievedCondition();
+    PoolThrottle& c_PlatformThrottle = p_PlatformPool->GetThrottle();
+    PoolThrottle& c_UserPoolThrottle = p_UserPool->GetThrottle();
+    PoolThrottle& c_UserProcessThrottle = p_UserProcess->GetThrottle();
+    
+    p_Loop->SetSource(MainLoop::PLATFORM_POOL, c_PlatformCondition.GetFD(), false);
+    p_Loop->SetSource(MainLoop::USER_POOL, c_UserCondition.GetFD(), false);
+    
     std::vector<Event> v_PlatformEvent;
     PackageConfiguration::OSAppType e_UserProccessOSAppType = PackageConfiguration::OSAppType::NONE;
     bool b_UserProcessStopDisabled = false; // Silence warning, can't be accessed before a process starts
@@ -428,10 +467,56 @@ int main(int argc, char* argv[])
     
     while (i_LastSignal != SIGTERM)
     {
+        /**
+         *  Step 0: Wait for a source to become ready
+         */
+        
+        if (b_UserProcessRunning == true)
+        {
+            // Wait without timeout if everything can be watched
+            // @NOTE: A throttled user process is not read and therefore not watched
+            MRH_Sint32 s32_TimeoutMS = -1;
+            int i_RecieveFD = (p_UserProcess->GetRecieveThrottled() == false ? p_UserProcess->GetRecievePollFD() : -1);
+            
+            if (i_RecieveFD >= 0 && p_UserProcess->PrepareRecievePoll() == false)
+            {
+                // Already readable, don't wait
+                i_RecieveFD = -1;
+                s32_TimeoutMS = 0;
+            }
+            else if (i_RecieveFD < 0 || p_Loop->GetSource(MainLoop::USER_PROCESS_STATE) < 0)
+            {
+                s32_TimeoutMS = c_CoreConfiguration.GetRecieveTimeoutMS(CoreConfiguration::USER_APP);
+            }
+            
+            p_Loop->SetSource(MainLoop::USER_PROCESS_RECIEVE, i_RecieveFD, false);
+            p_Loop->SetSource(MainLoop::USER_PROCESS_SEND, p_UserProcess->GetSendPollFD(), true);
+            p_Loop->Wait(s32_TimeoutMS);
+        }
+        else
+        {
+            // Launch pending, only collect ready sources
+            p_Loop->Wait(0);
+        }
+        
         /**
          *  Step 1: Signal handling
          */
         
+        if (p_Loop->GetReady(MainLoop::SIGNAL) == true)
+        {
+            int i_Signal = p_Loop->ReadSignal();
+            
+            if (i_Signal == SIGTERM)
+            {
+                break;
+            }
+            else if (i_Signal != -1)
+            {
+                i_LastSignal = i_Signal;
+            }
+        }
+        
         if (i_LastSignal != -1)
         {
             switch (i_LastSignal)
@@ -439,6 +524,20 @@ int main(int argc, char* argv[])
                 case SIGHUP:
                     LoadVariableConfiguration();
                     p_UserPool->Reload();
+                    EventAllocator::Singleton().LogStatistics();
+                    EventLane::Singleton().LogStatistics();
+                    EventTrace::Singleton().LogStatistics();
+                    p_PlatformPool->GetThrottle().LogStatistics();
+                    p_UserPool->GetThrottle().LogStatistics();
+                    p_PlatformPool->LogStatistics();
+                    p_UserPool->LogStatistics();
+                    p_UserProcess->GetThrottle().LogStatistics();
+                    p_UserProcess->LogStatistics();
+                    c_Logger.LogStatistics();
+                    break;
+                
+                case SIGUSR1:
+                    EventLogger::Singleton().UpdateFilter();
                     break;
                 
                 default:
@@ -453,22 +552,45 @@ int main(int argc, char* argv[])
          */
         
         // Platform Service Pool -> User Processes, Input Handler
-        p_PlatformPool->LockRecievedEvents();
-        v_PlatformEvent = std::vector<Event>(p_PlatformPool->RetrieveEvents()); // Copy needed, can't lock all the way
-        p_PlatformPool->RetrieveEvents().clear(); // Usually cleared by reciever, but we copy here!
-        p_PlatformPool->UnlockRecievedEvents();
-
-        /**
-         *  Step 3: Update input handler
-         */
-        
-        p_Input->Update(v_PlatformEvent);
+        if (p_Loop->GetReady(MainLoop::PLATFORM_POOL) == true)
+        {
+            c_PlatformCondition.Clear();
+            
+            // Events of the last update are not kept, the buffer is reused by the pool
+            p_PlatformPool->SwapRecievedEvents(v_PlatformEvent);
+            
+#if MRH_CORE_EVENT_TRACING > 0
+            for (auto& Recieved : v_PlatformEvent)
+            {
+                EventTrace::Singleton().Record(EventTrace::CORE, Recieved, 0);
+            }
+#endif
+            
+            /**
+             *  Step 3: Update input handler
+             */
+            
+            p_Input->Update(v_PlatformEvent);
+        }
+        else
+        {
+            v_PlatformEvent.clear();
+        }
         
         /**
          *  Step 4: Update user process
          */
         
-        p_UserProcess->GetProcessState(b_UserProcessRunning, i_UserProcessStatus);
+        // Only check the process state on exit or while launching
+        if (b_UserProcessRunning == false || p_Loop->GetReady(MainLoop::USER_PROCESS_STATE) == true)
+        {
+            p_UserProcess->GetProcessState(b_UserProcessRunning, i_UserProcessStatus);
+            
+            if (b_UserProcessRunning == true)
+            {
+                p_Loop->SetUserProcess(p_UserProcess->GetProcessID());
+            }
+        }
         
         if (b_UserProcessRunning == true)
         {
@@ -496,17 +618,21 @@ int main(int argc, char* argv[])
                 }
                 
                 /**
-                 *  Step 5.3: Exchange user events (process + pool) with platform service pool
+                 *  Step 5.3: Exchange user process events with platform service pool
                  */
                 
-                // User Service Pool -> Platform Service Pool
-                p_UserPool->LockRecievedEvents();
-                p_PlatformPool->SendEvents(p_UserPool->RetrieveEvents());
-                p_UserPool->UnlockRecievedEvents();
-                    
                 // User Process -> Platform Service Pool
-                p_UserProcess->RecieveEvents();
-                p_PlatformPool->SendEvents(p_UserProcess->RetrieveEvents());
+                if (p_Loop->GetReady(MainLoop::USER_PROCESS_RECIEVE) == true || p_Loop->GetSource(MainLoop::USER_PROCESS_RECIEVE) < 0)
+                {
+                    p_UserProcess->RecieveEvents();
+#if MRH_CORE_EVENT_TRACING > 0
+                    for (auto& Recieved : p_UserProcess->RetrieveEvents())
+                    {
+                        EventTrace::Singleton().Record(EventTrace::CORE, Recieved, 0);
+                    }
+#endif
+                    p_PlatformPool->SendEvents(p_UserProcess->RetrieveEvents());
+                }
                 
                 // Platform Service Pool -> User Process
                 p_UserProcess->SendEvents(v_PlatformEvent);
@@ -518,6 +644,11 @@ int main(int argc, char* argv[])
              *  Step 6.1: Check why a process is not running
              */
             
+            // Stop watching before the sources are reset by the next launch
+            p_Loop->SetSource(MainLoop::USER_PROCESS_RECIEVE, -1, false);
+            p_Loop->SetSource(MainLoop::USER_PROCESS_SEND, -1, true);
+            p_Loop->SetUserProcess(-1);
+            
             // How did the process exit?
             if (i_UserProcessStatus == EXIT_SUCCESS)
             {
@@ -568,7 +699,10 @@ int main(int argc, char* argv[])
             try
             {
                 InputHandler::LaunchRequest c_Request = p_Input->GetLaunchRequest(true);
-                Package const& c_Package = PackageContainer::Singleton().GetPackage(c_Request.s_PackagePath);
+                
+                // Hold the catalog, a reload replaces but never changes it
+                std::shared_ptr<const PackageContainer::Catalog> p_Catalog = PackageContainer::Singleton().GetCatalog();
+                Package const& c_Package = p_Catalog->GetPackage(c_Request.s_PackagePath);
                 
                 // Reset input handler for new package process
                 p_Input->ClearPasswordVerification();
@@ -621,6 +755,26 @@ int main(int argc, char* argv[])
                              "Main.cpp", __LINE__);
             }
         }
+        
+        /**
+         *  Step 7: Pass consumer credits to the producers
+         */
+        
+        // User service events are forwarded by the user service pool,
+        // it only signals throttle changes
+        if (p_Loop->GetReady(MainLoop::USER_POOL) == true)
+        {
+            c_UserCondition.Clear();
+        }
+        
+        // Platform services produce for the user process and user services,
+        // the user process and user services produce for platform services
+        size_t us_PlatformCredit = c_PlatformThrottle.GetCredit();
+        size_t us_UserCredit = std::min(c_UserPoolThrottle.GetCredit(), c_UserProcessThrottle.GetCredit());
+        
+        c_PlatformThrottle.SetProducerCredit(us_UserCredit);
+        c_UserPoolThrottle.SetProducerCredit(us_PlatformCredit);
+        c_UserProcessThrottle.SetProducerCredit(us_PlatformCredit);
     }
     
     // All done, now terminate
@@ -633,6 +787,12 @@ int main(int argc, char* argv[])
     delete p_UserPool;
     delete p_PlatformPool;
     delete p_Input;
+    delete p_Loop;
+    
+    EventAllocator::Singleton().LogStatistics();
+    EventLane::Singleton().LogStatistics();
+    EventTrace::Singleton().LogStatistics();
+    c_Logger.LogStatistics();
     
     c_Logger.Log(Logger::INFO, "Successfully closed core.", "Main.cpp", __LINE__);
     return EXIT_SUCCESS;
@@ -0,0 +1,274 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <csignal>
+#include <cerrno>
+#include <cstring>
+
+// External
+
+// Project
+#include "./MainLoop.h"
+#include "./Process/ProcessException.h"
+#include "./Logger/Logger.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+MainLoop::MainLoop() : s32_ProcessID(-1)
+{
+    for (size_t i = 0; i < SOURCE_COUNT; ++i)
+    {
+        p_SourceFD[i] = -1;
+        p_SourceEvents[i] = 0;
+        p_Ready[i] = true;
+    }
+    
+    if ((i_EpollFD = epoll_create1(EPOLL_CLOEXEC)) < 0)
+    {
+        throw ProcessException("Failed to create main loop: " + std::string(std::strerror(errno)) + " (" + std::to_string(errno) + ")!");
+    }
+    
+    // Block termination, reload and event log signals, they are read from the signal fd
+    // @NOTE: Threads created afterwards inherit the mask, child processes reset it
+    sigset_t c_Mask;
+    sigemptyset(&c_Mask);
+    sigaddset(&c_Mask, SIGTERM);
+    sigaddset(&c_Mask, SIGHUP);
+    sigaddset(&c_Mask, SIGINT);
+    sigaddset(&c_Mask, SIGUSR1);
+    
+    int i_Error = pthread_sigmask(SIG_BLOCK, &c_Mask, NULL);
+    int i_SignalFD;
+    
+    if (i_Error != 0)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to block signals: " +
+                                                 std::string(std::strerror(i_Error)) +
+                                                 " (" +
+                                                 std::to_string(i_Error) +
+                                                 ")! Using signal handlers.",
+                                "MainLoop.cpp", __LINE__);
+        return;
+    }
+    else if ((i_SignalFD = signalfd(-1, &c_Mask, SFD_NONBLOCK | SFD_CLOEXEC)) < 0)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to create signal fd: " +
+                                                 std::string(std::strerror(errno)) +
+                                                 " (" +
+                                                 std::to_string(errno) +
+                                                 ")! Using signal handlers.",
+                                "MainLoop.cpp", __LINE__);
+        
+        pthread_sigmask(SIG_UNBLOCK, &c_Mask, NULL);
+        return;
+    }
+    
+    SetSource(SIGNAL, i_SignalFD, false);
+    
+    if (p_SourceFD[SIGNAL] < 0)
+    {
+        close(i_SignalFD);
+        pthread_sigmask(SIG_UNBLOCK, &c_Mask, NULL);
+    }
+}
+
+MainLoop::~MainLoop() noexcept
+{
+    if (p_SourceFD[SIGNAL] >= 0)
+    {
+        close(p_SourceFD[SIGNAL]);
+    }
+    
+    if (p_SourceFD[USER_PROCESS_STATE] >= 0)
+    {
+        close(p_SourceFD[USER_PROCESS_STATE]);
+    }
+    
+    close(i_EpollFD);
+}
+
+//*************************************************************************************
+// Wait
+//*************************************************************************************
+
+void MainLoop::Wait(MRH_Sint32 s32_TimeoutMS) noexcept
+{
+    struct epoll_event p_Event[SOURCE_COUNT];
+    
+    for (size_t i = 0; i < SOURCE_COUNT; ++i)
+    {
+        p_Ready[i] = false;
+    }
+    
+    int i_Count = epoll_wait(i_EpollFD, p_Event, SOURCE_COUNT, s32_TimeoutMS);
+    
+    if (i_Count < 0 && errno != EINTR)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Main loop wait failed: " +
+                                                 std::string(std::strerror(errno)) +
+                                                 " (" +
+                                                 std::to_string(errno) +
+                                                 ")!",
+                                "MainLoop.cpp", __LINE__);
+    }
+    
+    for (int i = 0; i < i_Count; ++i)
+    {
+        p_Ready[p_Event[i].data.u32] = true;
+    }
+    
+    // Without a process fd the state has to be checked on every update
+    if (p_SourceFD[USER_PROCESS_STATE] < 0)
+    {
+        p_Ready[USER_PROCESS_STATE] = true;
+    }
+}
+
+int MainLoop::ReadSignal() noexcept
+{
+    if (p_SourceFD[SIGNAL] < 0)
+    {
+        return -1;
+    }
+    
+    struct signalfd_siginfo c_Info;
+    int i_Signal = -1;
+    
+    while (read(p_SourceFD[SIGNAL], &c_Info, sizeof(c_Info)) == sizeof(c_Info))
+    {
+        // Termination is never replaced by another signal
+        if (i_Signal != SIGTERM)
+        {
+            i_Signal = static_cast<int>(c_Info.ssi_signo);
+        }
+    }
+    
+    return i_Signal;
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+bool MainLoop::GetReady(Source e_Source) const noexcept
+{
+    return p_Ready[e_Source];
+}
+
+int MainLoop::GetSource(Source e_Source) const noexcept
+{
+    return p_SourceFD[e_Source];
+}
+
+//*************************************************************************************
+// Setters
+//*************************************************************************************
+
+void MainLoop::SetSource(Source e_Source, int i_FD, bool b_Write) noexcept
+{
+    MRH_Uint32 u32_Events = (b_Write == true ? EPOLLOUT : EPOLLIN);
+    
+    if (p_SourceFD[e_Source] == i_FD && (i_FD < 0 || p_SourceEvents[e_Source] == u32_Events))
+    {
+        return;
+    }
+    
+    // Remove the previous file descriptor first
+    if (p_SourceFD[e_Source] >= 0)
+    {
+        epoll_ctl(i_EpollFD, EPOLL_CTL_DEL, p_SourceFD[e_Source], NULL);
+        p_SourceFD[e_Source] = -1;
+    }
+    
+    if (i_FD < 0)
+    {
+        return;
+    }
+    
+    struct epoll_event c_Event;
+    c_Event.events = u32_Events;
+    c_Event.data.u32 = e_Source;
+    
+    if (epoll_ctl(i_EpollFD, EPOLL_CTL_ADD, i_FD, &c_Event) < 0)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to watch main loop source " +
+                                                 std::to_string(e_Source) +
+                                                 ": " +
+                                                 std::string(std::strerror(errno)) +
+                                                 " (" +
+                                                 std::to_string(errno) +
+                                                 ")!",
+                                "MainLoop.cpp", __LINE__);
+        return;
+    }
+    
+    p_SourceFD[e_Source] = i_FD;
+    p_SourceEvents[e_Source] = u32_Events;
+}
+
+void MainLoop::SetUserProcess(pid_t s32_ProcessID) noexcept
+{
+    if (this->s32_ProcessID == s32_ProcessID)
+    {
+        return;
+    }
+    
+    // Close the previous process fd
+    int i_ProcessFD = p_SourceFD[USER_PROCESS_STATE];
+    
+    if (i_ProcessFD >= 0)
+    {
+        SetSource(USER_PROCESS_STATE, -1, false);
+        close(i_ProcessFD);
+    }
+    
+    this->s32_ProcessID = s32_ProcessID;
+    
+    if (s32_ProcessID < 0)
+    {
+        return;
+    }
+    
+#ifdef SYS_pidfd_open
+    if ((i_ProcessFD = static_cast<int>(syscall(SYS_pidfd_open, s32_ProcessID, 0))) < 0)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to open process fd for " +
+                                                 std::to_string(s32_ProcessID) +
+                                                 ": " +
+                                                 std::string(std::strerror(errno)) +
+                                                 " (" +
+                                                 std::to_string(errno) +
+                                                 ")!",
+                                "MainLoop.cpp", __LINE__);
+        return;
+    }
+    
+    SetSource(USER_PROCESS_STATE, i_ProcessFD, false);
+    
+    if (p_SourceFD[USER_PROCESS_STATE] < 0)
+    {
+        close(i_ProcessFD);
+    }
+#endif
+}
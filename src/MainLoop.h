@@ -0,0 +1,165 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+ 
+#ifndef MainLoop_h
+#define MainLoop_h
+
+// C / C++
+#include <unistd.h>
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+
+
+class MainLoop
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef enum
+    {
+        SIGNAL = 0,
+        USER_PROCESS_STATE = 1,
+        USER_PROCESS_RECIEVE = 2,
+        USER_PROCESS_SEND = 3,
+        PLATFORM_POOL = 4,
+        USER_POOL = 5,
+        
+        SOURCE_MAX = USER_POOL,
+        
+        SOURCE_COUNT = SOURCE_MAX + 1
+        
+    }Source;
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. SIGTERM, SIGHUP, SIGINT and SIGUSR1 are blocked for the calling
+     *  thread and all threads created afterwards.
+     */
+    
+    MainLoop();
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_MainLoop MainLoop class source.
+     */
+    
+    MainLoop(MainLoop const& c_MainLoop) = delete;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~MainLoop() noexcept;
+    
+    //*************************************************************************************
+    // Wait
+    //*************************************************************************************
+    
+    /**
+     *  Wait for sources to become ready.
+     *
+     *  \param s32_TimeoutMS The wait timeout in milliseconds, -1 to wait without timeout.
+     */
+    
+    void Wait(MRH_Sint32 s32_TimeoutMS) noexcept;
+    
+    /**
+     *  Read all pending signals.
+     *
+     *  \return SIGTERM if requested, otherwise the last signal read or -1 if none.
+     */
+    
+    int ReadSignal() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if a source became ready in the last wait. All sources are ready
+     *  before the first wait.
+     *
+     *  \param e_Source The source to check.
+     *
+     *  \return true if the source is ready, false if not.
+     */
+    
+    bool GetReady(Source e_Source) const noexcept;
+    
+    /**
+     *  Get the file descriptor watched for a source.
+     *
+     *  \param e_Source The source requested.
+     *
+     *  \return The file descriptor on success, -1 if not watched.
+     */
+    
+    int GetSource(Source e_Source) const noexcept;
+    
+    //*************************************************************************************
+    // Setters
+    //*************************************************************************************
+    
+    /**
+     *  Set the file descriptor to watch for a source.
+     *
+     *  \param e_Source The source to set.
+     *  \param i_FD The file descriptor to watch, -1 to stop watching.
+     *  \param b_Write If the file descriptor is watched for writing.
+     */
+    
+    void SetSource(Source e_Source, int i_FD, bool b_Write) noexcept;
+    
+    /**
+     *  Set the user process to watch for termination.
+     *
+     *  \param s32_ProcessID The user process id, -1 to stop watching.
+     */
+    
+    void SetUserProcess(pid_t s32_ProcessID) noexcept;
+
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    int i_EpollFD;
+    
+    // Sources
+    int p_SourceFD[SOURCE_COUNT];
+    MRH_Uint32 p_SourceEvents[SOURCE_COUNT];
+    bool p_Ready[SOURCE_COUNT];
+    
+    // User process
+    pid_t s32_ProcessID;
+
+protected:
+
+};
+
+#endif /* MainLoop_h */
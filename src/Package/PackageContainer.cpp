@@ -35,12 +35,15 @@
 // Constructor / Destructor
 //*************************************************************************************
 
-PackageContainer::PackageContainer() noexcept
+PackageContainer::PackageContainer() noexcept : p_Catalog(new Catalog(0))
 {}
 
 PackageContainer::~PackageContainer() noexcept
 {}
 
+PackageContainer::Catalog::Catalog(MRH_Uint32 u32_Generation) noexcept : u32_Generation(u32_Generation)
+{}
+
 //*************************************************************************************
 // Singleton
 //*************************************************************************************
@@ -57,15 +60,24 @@ PackageContainer& PackageContainer::Singleton() noexcept
 
 void PackageContainer::Reload() noexcept
 {
-    // Lock during whole operation
+    // Only one reload at a time, readers keep using the current catalog
     std::lock_guard<std::mutex> c_Guard(c_Mutex);
     
-    // Clear old first
-    v_Package.clear();
-    
-    // Now read each given path and add if possible
     Logger& c_Logger = Logger::Singleton();
+    std::shared_ptr<Catalog> p_Next;
     
+    try
+    {
+        p_Next = std::shared_ptr<Catalog>(new Catalog(GetCatalog()->u32_Generation + 1));
+    }
+    catch (std::exception& e)
+    {
+        c_Logger.Log(Logger::WARNING, "Failed to create package catalog: " + std::string(e.what()),
+                     "PackageContainer.cpp", __LINE__);
+        return;
+    }
+    
+    // Now read each given path and add if possible
     try
     {
         std::vector<std::string> v_Path = PackageList().GetPackages();
@@ -109,13 +121,26 @@ void PackageContainer::Reload() noexcept
                                                " not valid: Extension missmatch!",
                                  "PackageList.cpp", __LINE__);
                 }
+                else if (p_Next->m_Path.find(Path + "/") != p_Next->m_Path.end())
+                {
+                    // Listed twice, the home package is commonly in the package list
+                    continue;
+                }
                 else
                 {
                     std::string s_Location = Path.substr(0, Path.find_last_of('/') + 1);
                     std::string s_Package = Path.substr(Path.find_last_of('/') + 1);
                     
-                    v_Package.emplace_back(s_Location,
-                                           s_Package);
+                    p_Next->v_Package.emplace_back(s_Location,
+                                                   s_Package);
+                    
+                    // Index the added package, names keep the first package
+                    Package const& c_Package = p_Next->v_Package.back();
+                    size_t us_Package = p_Next->v_Package.size() - 1;
+                    
+                    p_Next->m_Path.emplace(c_Package.GetPackagePath(), us_Package);
+                    p_Next->m_Name.emplace(c_Package.GetPackageName(), us_Package);
+                    
                     c_Logger.Log(Logger::INFO, "Loaded package: " + Path, "PackageList.cpp", __LINE__);
                 }
             }
@@ -136,22 +161,34 @@ void PackageContainer::Reload() noexcept
         c_Logger.Log(Logger::WARNING, "Package list failed to load: " + e.what2(),
                      "PackageContainer.cpp", __LINE__);
     }
+    
+    // Publish, catalogs still held by readers are released with their last user
+    std::atomic_store(&p_Catalog, std::shared_ptr<const Catalog>(p_Next));
+    
+    c_Logger.Log(Logger::INFO, "Package catalog " +
+                               std::to_string(p_Next->u32_Generation) +
+                               " loaded with " +
+                               std::to_string(p_Next->v_Package.size()) +
+                               " packages.",
+                 "PackageContainer.cpp", __LINE__);
 }
 
 //*************************************************************************************
 // Getters
 //*************************************************************************************
 
-size_t PackageContainer::GetPackageCount() noexcept
+std::shared_ptr<const PackageContainer::Catalog> PackageContainer::GetCatalog() const noexcept
+{
+    return std::atomic_load(&p_Catalog);
+}
+
+size_t PackageContainer::Catalog::GetPackageCount() const noexcept
 {
-    std::lock_guard<std::mutex> c_Guard(c_Mutex);
     return v_Package.size();
 }
 
-Package const& PackageContainer::GetPackage(size_t us_Package)
+Package const& PackageContainer::Catalog::GetPackage(size_t us_Package) const
 {
-    std::lock_guard<std::mutex> c_Guard(c_Mutex);
-    
     if (v_Package.size() > us_Package)
     {
         return v_Package[us_Package];
@@ -160,42 +197,52 @@ Package const& PackageContainer::GetPackage(size_t us_Package)
     throw PackageException("No package for index " + std::to_string(us_Package) + "!", "PackageContainer");
 }
 
-Package const& PackageContainer::GetPackage(std::string s_PackagePath)
+Package const& PackageContainer::Catalog::GetPackage(std::string s_PackagePath) const
 {
-    if (s_PackagePath.length() == 0 || s_PackagePath[s_PackagePath.size() - 1] != '/')
-    {
-        s_PackagePath += "/";
-    }
+    FormatPath(s_PackagePath);
     
-    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    auto Index = m_Path.find(s_PackagePath);
     
-    for (size_t i = 0; i < v_Package.size(); ++i)
+    if (Index != m_Path.end())
     {
-        if (s_PackagePath.compare(v_Package[i].GetPackagePath()) == 0)
-        {
-            return v_Package[i];
-        }
+        return v_Package[Index->second];
     }
     
     throw PackageException("No package for path " + s_PackagePath + "!", "PackageContainer");
 }
 
-bool PackageContainer::GetPackageExists(std::string s_PackagePath) noexcept
+Package const& PackageContainer::Catalog::GetPackageByName(std::string const& s_PackageName) const
 {
-    if (s_PackagePath.length() == 0 || *(s_PackagePath.end() - 1) != '/')
+    auto Index = m_Name.find(s_PackageName);
+    
+    if (Index != m_Name.end())
     {
-        s_PackagePath += "/";
+        return v_Package[Index->second];
     }
     
-    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    throw PackageException("No package for name " + s_PackageName + "!", "PackageContainer");
+}
+
+bool PackageContainer::Catalog::GetPackageExists(std::string s_PackagePath) const noexcept
+{
+    FormatPath(s_PackagePath);
     
-    for (auto& Package : v_Package)
+    return m_Path.find(s_PackagePath) != m_Path.end();
+}
+
+MRH_Uint32 PackageContainer::Catalog::GetGeneration() const noexcept
+{
+    return u32_Generation;
+}
+
+//*************************************************************************************
+// Path
+//*************************************************************************************
+
+void PackageContainer::Catalog::FormatPath(std::string& s_PackagePath) noexcept
+{
+    if (s_PackagePath.length() == 0 || *(s_PackagePath.end() - 1) != '/')
     {
-        if (Package.GetPackagePath().compare(s_PackagePath) == 0)
-        {
-            return true;
-        }
+        s_PackagePath += "/";
     }
-    
-    return false;
 }
@@ -19,9 +19,12 @@
 
 // C / C++
 #include <vector>
+#include <unordered_map>
+#include <memory>
 #include <mutex>
 
 // External
+#include <MRH_Typedefs.h>
 
 // Project
 #include "./Package.h"
@@ -31,6 +34,119 @@ class PackageContainer
 {
 public:
     
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    class Catalog
+    {
+        friend class PackageContainer;
+    
+    public:
+        
+        //*************************************************************************************
+        // Getters
+        //*************************************************************************************
+        
+        /**
+         *  Get the number of packages in this catalog.
+         *
+         *  \return The number of packages in this catalog.
+         */
+        
+        size_t GetPackageCount() const noexcept;
+        
+        /**
+         *  Get a package by index.
+         *
+         *  \param us_Package The package to get.
+         *
+         *  \return The requested package.
+         */
+        
+        Package const& GetPackage(size_t us_Package) const;
+        
+        /**
+         *  Get a package by package path.
+         *
+         *  \param s_PackagePath The full path to the package.
+         *
+         *  \return The requested package.
+         */
+        
+        Package const& GetPackage(std::string s_PackagePath) const;
+        
+        /**
+         *  Get a package by package name. The first listed package is
+         *  returned if multiple packages share a name.
+         *
+         *  \param s_PackageName The package directory name.
+         *
+         *  \return The requested package.
+         */
+        
+        Package const& GetPackageByName(std::string const& s_PackageName) const;
+        
+        /**
+         *  Check if a package exists.
+         *
+         *  \param s_PackagePath The full package path.
+         *
+         *  \return true if the package exists, false if not.
+         */
+        
+        bool GetPackageExists(std::string s_PackagePath) const noexcept;
+        
+        /**
+         *  Get the reload generation of this catalog.
+         *
+         *  \return The catalog generation.
+         */
+        
+        MRH_Uint32 GetGeneration() const noexcept;
+    
+    private:
+        
+        //*************************************************************************************
+        // Constructor
+        //*************************************************************************************
+        
+        /**
+         *  Default constructor.
+         *
+         *  \param u32_Generation The catalog generation.
+         */
+        
+        Catalog(MRH_Uint32 u32_Generation) noexcept;
+        
+        //*************************************************************************************
+        // Path
+        //*************************************************************************************
+        
+        /**
+         *  Convert a package path to the form used for the path index.
+         *
+         *  \param s_PackagePath The package path to convert.
+         */
+        
+        static void FormatPath(std::string& s_PackagePath) noexcept;
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        std::vector<Package> v_Package;
+        
+        // Index into v_Package
+        std::unordered_map<std::string, size_t> m_Path;
+        std::unordered_map<std::string, size_t> m_Name;
+        
+        MRH_Uint32 u32_Generation;
+    
+    protected:
+    
+    };
+    
     //*************************************************************************************
     // Constructor
     //*************************************************************************************
@@ -60,7 +176,8 @@ public:
     //*************************************************************************************
 
     /**
-     *  Reload the package container. This function is thread safe.
+     *  Reload the package container. The new catalog replaces the current
+     *  one once fully loaded. This function is thread safe.
      */
 
     void Reload() noexcept;
@@ -70,42 +187,14 @@ public:
     //*************************************************************************************
 
     /**
-     *  Get the number of packages in this container. This function is thread safe.
-     *
-     *  \return The number of packages in this list.
-     */
-    
-    size_t GetPackageCount() noexcept;
-    
-    /**
-     *  Get a package by index. This function is thread safe.
-     *
-     *  \param us_Package The package to get.
-     *
-     *  \return The requested package.
-     */
-    
-    Package const& GetPackage(size_t us_Package);
-    
-    /**
-     *  Get a package by package name. This function is thread safe.
-     *
-     *  \param s_PackagePath The full path to the package.
-     *
-     *  \return The requested package.
-     */
-    
-    Package const& GetPackage(std::string s_PackagePath);
-    
-    /**
-     *  Check if a package exists. This function is thread safe.
-     *
-     *  \param s_PackagePath The full package path.
+     *  Get the current package catalog. The catalog stays valid and unchanged
+     *  for as long as it is held, reloads publish a new catalog. This function
+     *  is thread safe.
      *
-     *  \return true if the package exists, false if not.
+     *  \return The current package catalog.
      */
     
-    bool GetPackageExists(std::string s_PackagePath) noexcept;
+    std::shared_ptr<const Catalog> GetCatalog() const noexcept;
 
 private:
 
@@ -129,8 +218,9 @@ private:
     // Data
     //*************************************************************************************
 
+    // Readers load the catalog without the reload mutex
     std::mutex c_Mutex;
-    std::vector<Package> v_Package;
+    std::shared_ptr<const Catalog> p_Catalog;
 
 protected:
 
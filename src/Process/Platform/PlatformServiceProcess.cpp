@@ -27,15 +27,9 @@
 // Constructor / Destructor
 //*************************************************************************************
 
-#ifdef __MRH_MRHCKM_SUPPORTED__
-PlatformServiceProcess::PlatformServiceProcess() : ServiceProcess(TransmissionSource::SourceType::MRHCKM,
-                                                                  true,
-                                                                  true)
-#else
-PlatformServiceProcess::PlatformServiceProcess() : ServiceProcess(TransmissionSource::SourceType::PIPE,
-                                                                  true,
-                                                                  true)
-#endif
+PlatformServiceProcess::PlatformServiceProcess(TransmissionSource::SourceType e_Type) : ServiceProcess(e_Type,
+                                                                                                       true,
+                                                                                                       true)
 {}
 
 PlatformServiceProcess::~PlatformServiceProcess() noexcept
@@ -62,15 +56,25 @@ void PlatformServiceProcess::Run(std::string s_BinaryPath, MRH_Uint32 u32_EventL
         throw ProcessException("Failed to reset event queue: " + e.what2()); // Convert to process exception
     }
     
+#if MRH_CORE_EVENT_TRACING > 0
+    EventQueue::SetTraceEndpoint(s_BinaryPath);
+#endif
+    
     // Create arguments
     std::vector<std::vector<char>> v_Arg;
     
     try
     {
-        v_Arg.emplace_back(GetArgumentBytes(std::to_string(GetPipeFD(QueueType::P_W_C_R, SourcePipe::PipeEnd::PIPE_END_READ))));
-        v_Arg.emplace_back(GetArgumentBytes(std::to_string(GetPipeFD(QueueType::C_W_P_R, SourcePipe::PipeEnd::PIPE_END_WRITE))));
+        v_Arg.emplace_back(GetArgumentBytes(GetSourceArgument(QueueType::P_W_C_R)));
+        v_Arg.emplace_back(GetArgumentBytes(GetSourceArgument(QueueType::C_W_P_R)));
         v_Arg.emplace_back(GetArgumentBytes(std::to_string(u32_EventLimit)));
         v_Arg.emplace_back(GetArgumentBytes(std::to_string(s32_RecieveTimeoutMS)));
+        
+        // Legacy services ignore the trailing wire format offer
+        if (GetWireVersion() > 1)
+        {
+            v_Arg.emplace_back(GetArgumentBytes(std::to_string(GetWireVersion())));
+        }
     }
     catch (ProcessException& e)
     {
@@ -90,26 +94,24 @@ void PlatformServiceProcess::Run(std::string s_BinaryPath, MRH_Uint32 u32_EventL
     {
         throw;
     }
+    
+    EventLogger::Singleton().LogProcess(EventLogFormat::PLATFORM_SERVICE, GetProcessID(), GetRunPath());
 }
 
 //*************************************************************************************
 // Recieve
 //*************************************************************************************
     
-#if MRH_CORE_EVENT_LOGGING > 0
 void PlatformServiceProcess::LogRecievedEvents(Event const& c_Event) noexcept
 {
-    EventLogger::Singleton().Log(c_Event, "Recieved event from platform service process: " + GetRunPath());
+    EventLogger::Singleton().Log(c_Event, EventLogFormat::RECIEVED, EventLogFormat::PLATFORM_SERVICE, GetProcessID());
 }
-#endif
 
 //*************************************************************************************
 // Send
 //*************************************************************************************
 
-#if MRH_CORE_EVENT_LOGGING > 0
 void PlatformServiceProcess::LogSentEvents(Event const& c_Event) noexcept
 {
-    EventLogger::Singleton().Log(c_Event, "Sending event to platform service process: " + GetRunPath());
+    EventLogger::Singleton().Log(c_Event, EventLogFormat::SENT, EventLogFormat::PLATFORM_SERVICE, GetProcessID());
 }
-#endif
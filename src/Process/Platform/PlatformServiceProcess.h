@@ -35,9 +35,11 @@ public:
     
     /**
      *  Default constructor.
+     *
+     *  \param e_Type The transmission source type.
      */
     
-    PlatformServiceProcess();
+    PlatformServiceProcess(TransmissionSource::SourceType e_Type);
     
     /**
      *  Copy constructor. Disabled for this class.
@@ -77,9 +79,7 @@ public:
      *  \param c_Event The event to log.
      */
             
-#if MRH_CORE_EVENT_LOGGING > 0
     void LogRecievedEvents(Event const& c_Event) noexcept override;
-#endif
 
     //*************************************************************************************
     // Send
@@ -91,9 +91,7 @@ public:
      *  \param c_Event The event to log.
      */
             
-#if MRH_CORE_EVENT_LOGGING > 0
     void LogSentEvents(Event const& c_Event) noexcept override;
-#endif
     
 private:
 
@@ -77,6 +77,11 @@ void Process::Run(std::string s_BinaryPath, std::vector<std::vector<char>> v_Arg
                                               "):",
                                 "Process.cpp", __LINE__);
         
+        // Signals blocked for the core signal fd are kept by execv, unblock
+        sigset_t c_Mask;
+        sigemptyset(&c_Mask);
+        sigprocmask(SIG_SETMASK, &c_Mask, NULL);
+        
         // Add binary path
         v_Arg.insert(v_Arg.begin(), GetArgumentBytes(s_BinaryPath));
         
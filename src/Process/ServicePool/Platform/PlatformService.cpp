@@ -28,11 +28,13 @@
 
 PlatformService::PlatformService(std::shared_ptr<ServiceProcess>& p_Process,
                                  std::shared_ptr<PoolCondition>& p_Condition,
+                                 std::shared_ptr<PoolThrottle>& p_Throttle,
                                  MRH_Uint32 u32_EventLimit,
                                  MRH_Sint32 s32_TimeoutMS,
                                  bool b_Essential,
                                  MRH_Uint32 u32_RouteID) : PoolService(p_Process,
                                                                        p_Condition,
+                                                                       p_Throttle,
                                                                        u32_EventLimit,
                                                                        s32_TimeoutMS,
                                                                        b_Essential),
@@ -48,9 +50,7 @@ PlatformService::~PlatformService() noexcept
 
 void PlatformService::SendEvent(Event& c_Event) noexcept
 {
-    p_Mutex[SEND].lock();
-    p_Queue[SEND].emplace_back(c_Event);
-    p_Mutex[SEND].unlock();
+    p_Ring[SEND].Push(c_Event);
 }
 
 //*************************************************************************************
@@ -46,7 +46,8 @@ public:
     //*************************************************************************************
     
     /**
-     *  Add a event to send to the service. This function is thread safe.
+     *  Add a event to send to the service. This function may only be called
+     *  by the service pool update.
      *
      *  \param c_Event The event to send.
      */
@@ -76,6 +77,7 @@ private:
      *
      *  \param p_Process The process for this service.
      *  \param p_Condition The service pool condition for notification.
+     *  \param p_Throttle The service pool throttle limiting recieved events.
      *  \param u32_EventLimit The max amount of event to be sent / recieved in a update.
      *  \param s32_TimeoutMS The event recieve timeout in milliseconds.  
      *  \param b_Essential Wether the service is essential or not.
@@ -84,6 +86,7 @@ private:
     
     PlatformService(std::shared_ptr<ServiceProcess>& p_Process,
                     std::shared_ptr<PoolCondition>& p_Condition,
+                    std::shared_ptr<PoolThrottle>& p_Throttle,
                     MRH_Uint32 u32_EventLimit,
                     MRH_Sint32 s32_TimeoutMS,
                     bool b_Essential,
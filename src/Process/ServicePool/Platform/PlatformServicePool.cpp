@@ -16,6 +16,7 @@
 
 // C / C++
 #include <memory>
+#include <algorithm>
 
 // External
 
@@ -25,19 +26,30 @@
 #include "../../../Configuration/PlatformServiceList.h"
 #include "../../../Configuration/UserEventRoute.h"
 #include "../../../Configuration/CoreConfiguration.h"
+#include "../../../Event/EventMeta.h"
 #include "../../../FilePaths.h"
 #include "../../../Logger/Logger.h"
 
-
 //*************************************************************************************
 // Constructor / Destructor
 //*************************************************************************************
 
-PlatformServicePool::PlatformServicePool()
+PlatformServicePool::PlatformServicePool() : ServicePool("platform service", CoreConfiguration::PLATFORM_SERVICE)
 {
     CoreConfiguration& c_CoreConfiguration = CoreConfiguration::Singleton();
     MRH_Uint32 u32_EventLimit = c_CoreConfiguration.GetEventLimit(CoreConfiguration::PLATFORM_SERVICE);
     MRH_Sint32 s32_RecieveTimeoutMS = c_CoreConfiguration.GetRecieveTimeoutMS(CoreConfiguration::PLATFORM_SERVICE);
+    TransmissionSource::SourceType e_EventSource = c_CoreConfiguration.GetEventSource(CoreConfiguration::PLATFORM_SERVICE);
+    size_t us_PipeSize = c_CoreConfiguration.GetPipeSize(CoreConfiguration::PLATFORM_SERVICE);
+    size_t us_ReadBatchSize = c_CoreConfiguration.GetReadBatchSize(CoreConfiguration::PLATFORM_SERVICE);
+    MRH_Uint32 u32_WriteBatchSize = c_CoreConfiguration.GetWriteBatchSize(CoreConfiguration::PLATFORM_SERVICE);
+    MRH_Uint32 u32_WireVersion = c_CoreConfiguration.GetWireVersion(CoreConfiguration::PLATFORM_SERVICE);
+    
+    // Only events sent by users can be routed, all others are blocked
+    for (MRH_Uint32 i = 0; i < MRH_EVENT_TYPE_COUNT; ++i)
+    {
+        p_Route[i].b_Blocked = (EventMeta::Get(i).e_Direction != EventMeta::USER);
+    }
     
     try // Giant block, but all depends on service list being read successfully!
     {
@@ -68,31 +80,54 @@ PlatformServicePool::PlatformServicePool()
                 continue;
             }
             
-            // Add the event route for this service
-            auto Route = m_EventRoute.find(c_Service.u32_RouteID);
-            if (Route == m_EventRoute.end())
-            {
-                if (m_EventRoute.insert(std::make_pair(c_Service.u32_RouteID, c_EventRoute.GetRoute(c_Service.u32_RouteID))).second == false)
-                {
-                    throw ProcessException("Failed to add event route!");
-                }
-            }
+            // Get the event route for this service first, invalid routes throw
+            std::vector<MRH_Uint32> const& v_Route = c_EventRoute.GetRoute(c_Service.u32_RouteID);
             
             // We rather cast the shared_ptr to have a guarantee that this instance
             // deallocates on exception by going out of scope. This will also
             // terminate the running process.
-            std::shared_ptr<ServiceProcess> p_Process(new PlatformServiceProcess());
+            std::shared_ptr<ServiceProcess> p_Process(new PlatformServiceProcess(e_EventSource));
+            p_Process->SetTransport(c_Service.us_PipeSize > 0 ? c_Service.us_PipeSize : us_PipeSize,
+                                    c_Service.us_ReadBatchSize > 0 ? c_Service.us_ReadBatchSize : us_ReadBatchSize,
+                                    c_Service.u32_WriteBatchSize > 0 ? c_Service.u32_WriteBatchSize : u32_WriteBatchSize);
+            p_Process->SetWireVersion(c_Service.u32_WireVersion > 0 ? c_Service.u32_WireVersion : u32_WireVersion);
             std::dynamic_pointer_cast<PlatformServiceProcess>(p_Process)->Run(c_Service.s_BinaryPath,
                                                                               u32_EventLimit,
                                                                               s32_RecieveTimeoutMS);
             
-            v_Service.emplace_back(std::shared_ptr<PlatformService>(new PlatformService(p_Process,
-                                                                                        p_Condition,
-                                                                                        u32_EventLimit,
-                                                                                        s32_RecieveTimeoutMS,
-                                                                                        c_Service.b_Essential,
-                                                                                        c_Service.u32_RouteID)));
-            v_Pid.emplace_back((*(--(v_Service.end())))->GetProcess()->GetProcessID());
+            Logger::Singleton().Log(Logger::INFO, "Platform service " +
+                                                  c_Service.s_BinaryPath +
+                                                  " transport: " +
+                                                  p_Process->GetTransportInfo(),
+                                    "PlatformServicePool.cpp", __LINE__);
+            
+            std::shared_ptr<PlatformService> p_Service(new PlatformService(p_Process,
+                                                                           p_Condition,
+                                                                           p_Throttle,
+                                                                           u32_EventLimit,
+                                                                           s32_RecieveTimeoutMS,
+                                                                           c_Service.b_Essential,
+                                                                           c_Service.u32_RouteID));
+            v_PlatformService.emplace_back(p_Service.get());
+            v_Service.emplace_back(p_Service);
+            v_Pid.emplace_back(p_Service->GetProcess()->GetProcessID());
+            
+            // Add the service to the route of each event type
+            // @NOTE: Types listed twice in a route are only added once
+            for (auto& Type : v_Route)
+            {
+                if (Type > MRH_EVENT_TYPE_MAX || p_Route[Type].b_Blocked == true)
+                {
+                    continue;
+                }
+                
+                std::vector<size_t>& v_RouteService = p_Route[Type].v_Service;
+                
+                if (v_RouteService.size() == 0 || v_RouteService.back() != v_PlatformService.size() - 1)
+                {
+                    v_RouteService.emplace_back(v_PlatformService.size() - 1);
+                }
+            }
         }
         
         // Write pid list
@@ -129,14 +164,14 @@ PlatformServicePool::~PlatformServicePool() noexcept
 
 void PlatformServicePool::DistributeSendEvents() noexcept
 {
-    // Lock send queue
-    // @NOTE: This lock stops the service pool update thread. The caller
-    //        would have to wait anyway until all events are processed.
-    p_Mutex[SEND].lock();
+    // Take all events added since the last update
+    if (p_Ring[SEND].Take(p_Queue[SEND]) == 0)
+    {
+        return;
+    }
     
-    // Loop event list and service list. This makes sure events are properly
-    // duplicated for each service with a valid source.
-    // @NOTE: Event list is the outer loop for shorter inner loops
+    // One route lookup per event, events are duplicated for each
+    // service in the route
     for (auto& Event : p_Queue[SEND])
     {
         // Is this a valid event number?
@@ -149,132 +184,63 @@ void PlatformServicePool::DistributeSendEvents() noexcept
             continue;
         }
         
-        // Check which type of event this is
-        switch (Event.GetType())
+        Route const& c_Route = p_Route[Event.GetType()];
+        
+        if (c_Route.b_Blocked == true)
         {
-            /**
-             *  Event Version 1
-             */
- 
-            // Unknown
-            case MRH_EVENT_UNK:
-                
-            // Permission
-            case MRH_EVENT_PERMISSION_DENIED:
-                
-            // Password Required
-            case MRH_EVENT_PASSWORD_REQUIRED:
-                
-            // Not implemented
-            case MRH_EVENT_NOT_IMPLEMENTED_S:
-                
-            // Program state
-            case MRH_EVENT_PS_RESET_ACKNOLEDGED_U: // Not sent by the user, block
-                
-            // Custom
-            case MRH_EVENT_CUSTOM_AVAIL_S:
-            case MRH_EVENT_CUSTOM_CUSTOM_COMMAND_S:
-                
-            // Voice - Listen
-            case MRH_EVENT_LISTEN_AVAIL_S:
-            case MRH_EVENT_LISTEN_STRING_S:
-            case MRH_EVENT_LISTEN_GET_METHOD_S:
-            case MRH_EVENT_LISTEN_CUSTOM_COMMAND_S:
-                
-            // Voice - Say
-            case MRH_EVENT_SAY_AVAIL_S:
-            case MRH_EVENT_SAY_STRING_S:
-            case MRH_EVENT_SAY_GET_METHOD_S:
-            case MRH_EVENT_SAY_NOTIFICATION_APP_S:
-            case MRH_EVENT_SAY_CUSTOM_COMMAND_S:
-                
-            // Password
-            case MRH_EVENT_PASSWORD_AVAIL_S:
-            case MRH_EVENT_PASSWORD_CHECK_S:
-            case MRH_EVENT_PASSWORD_SET_S:
-            case MRH_EVENT_PASSWORD_CUSTOM_COMMAND_S:
-                
-            // User
-            case MRH_EVENT_USER_AVAIL_S:
-            case MRH_EVENT_USER_ACCESS_DOCUMENTS_S:
-            case MRH_EVENT_USER_ACCESS_PICTURES_S:
-            case MRH_EVENT_USER_ACCESS_MUSIC_S:
-            case MRH_EVENT_USER_ACCESS_VIDEOS_S:
-            case MRH_EVENT_USER_ACCESS_DOWNLOADS_S:
-            case MRH_EVENT_USER_ACCESS_CLIPBOARD_S:
-            case MRH_EVENT_USER_ACCESS_INFO_PERSON_S:
-            case MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_S:
-            case MRH_EVENT_USER_ACCESS_CLEAR_S:
-            case MRH_EVENT_USER_GET_LOCATION_S:
-            case MRH_EVENT_USER_CUSTOM_COMMAND_S:
-                
-            // Application
-            case MRH_EVENT_APP_AVAIL_S:
-            case MRH_EVENT_APP_LAUNCH_SOA_S:
-            case MRH_EVENT_APP_LAUNCH_SOA_TIMER_S:
-            case MRH_EVENT_APP_LAUNCH_SOA_TIMER_REMINDER_S:
-            case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_S:
-            case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_S:
-            case MRH_EVENT_APP_CUSTOM_COMMAND_S:
-                Logger::Singleton().Log(Logger::WARNING, "Event " +
-                                                         std::to_string(Event.GetType()) +
-                                                         " is not allowed to be sent to platform services!",
-                                        "PlatformServicePool.cpp", __LINE__);
-                break;
-                
-            /**
-             *  All - User Event
-             */
-                
-            // The event is not from a service, give it to all services requiring it
-            default:
-                for (auto& Service : v_Service) // No service locking, not meant to be changed
-                {
-                    try
-                    {
-                        auto p_Service = std::dynamic_pointer_cast<PlatformService>(Service);
-                        
-                        if (GetEventInRoute(p_Service->GetRouteID(), Event.GetType()) == true)
-                        {
-                            p_Service->SendEvent(Event);
-                        }
-                    }
-                    catch (std::exception& e) // dynamic cast
-                    {
-                        Logger::Singleton().Log(Logger::WARNING, e.what(), "PlatformServicePool.cpp", __LINE__);
-                    }
-                }
-                break;
+            Logger::Singleton().Log(Logger::WARNING, "Event " +
+                                                     std::to_string(Event.GetType()) +
+                                                     " is not allowed to be sent to platform services!",
+                                    "PlatformServicePool.cpp", __LINE__);
+            continue;
+        }
+        
+        // The event is not from a service, give it to all services requiring it
+        for (auto& Service : c_Route.v_Service) // No service locking, not meant to be changed
+        {
+            v_PlatformService[Service]->SendEvent(Event);
         }
     }
     
+    // Wake service updates waiting for events to send
+    for (auto& Service : v_Service)
+    {
+        Service->NotifySend();
+    }
+    
     // All sent, clear original
     p_Queue[SEND].clear();
-    p_Mutex[SEND].unlock();
 }
 
 //*************************************************************************************
-// Getters
+// Service
 //*************************************************************************************
 
-bool PlatformServicePool::GetEventInRoute(MRH_Uint32 u32_RouteID, MRH_Uint32 u32_Type) noexcept
+void PlatformServicePool::RemoveService(PoolService* p_Service) noexcept
 {
-    auto Route = m_EventRoute.find(u32_RouteID);
-    
-    if (Route != m_EventRoute.end())
+    for (size_t i = 0; i < v_PlatformService.size(); ++i)
     {
-        for (auto& Type : Route->second)
+        if (v_PlatformService[i] != p_Service)
         {
-            if (Type == u32_Type)
-            {
-                return true;
-            }
+            continue;
         }
+        
+        // Keep indices of other services valid
+        v_PlatformService[i] = NULL;
+        
+        for (auto& Route : p_Route)
+        {
+            Route.v_Service.erase(std::remove(Route.v_Service.begin(), Route.v_Service.end(), i), Route.v_Service.end());
+        }
+        
+        return;
     }
-    
-    return false;
 }
 
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
 bool PlatformServicePool::GetAllRunning() const noexcept
 {
     for (auto& Service : v_Service)
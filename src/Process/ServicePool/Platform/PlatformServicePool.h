@@ -18,7 +18,7 @@
 #define PlatformServicePool_h
 
 // C / C++
-#include <unordered_map>
+#include <vector>
 
 // External
 
@@ -68,7 +68,20 @@ public:
     bool GetAllRunning() const noexcept;
     
 private:
-
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Route
+    {
+        // Service events are never sent to platform services
+        bool b_Blocked;
+        
+        // Indices of services recieving the event type
+        std::vector<size_t> v_Service;
+    };
+    
     //*************************************************************************************
     // Send
     //*************************************************************************************
@@ -78,28 +91,28 @@ private:
      */
 
     void DistributeSendEvents() noexcept override;
-
+    
     //*************************************************************************************
-    // Getters
+    // Service
     //*************************************************************************************
     
     /**
-     *  Check if a service event route can recieve a event.
+     *  Remove a stopped service from the event routes.
      *
-     *  \param u32_RouteID The service event route id.
-     *  \param u32_Type The event type.
-     *
-     *  \return true if the event is part of this route, false if not.
+     *  \param p_Service The stopped service.
      */
     
-    bool GetEventInRoute(MRH_Uint32 u32_RouteID, MRH_Uint32 u32_Type) noexcept;
+    void RemoveService(PoolService* p_Service) noexcept override;
     
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
-    // <Route ID, Event Vector<Event ID>>
-    std::unordered_map<MRH_Uint32, std::vector<MRH_Uint32>> m_EventRoute;
+    // Services by index, shared with the service vector
+    std::vector<PlatformService*> v_PlatformService;
+    
+    // Event type to recieving service indices, compiled from the event routes
+    Route p_Route[MRH_EVENT_TYPE_COUNT];
     
 protected:
 
@@ -14,50 +14,114 @@
  *  limitations under the License.
  */
 
+
 // C / C++
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <poll.h>
+#include <cerrno>
+#include <cstring>
 
 // External
 
 // Project
 #include "./PoolCondition.h"
+#include "../ProcessException.h"
+#include "../../Logger/Logger.h"
 
 
 //*************************************************************************************
 // Constructor / Destructor
 //*************************************************************************************
 
-PoolCondition::PoolCondition() noexcept
-{}
+PoolCondition::PoolCondition() : b_Signaled(false),
+                                 u64_Pending(0)
+{
+    if ((i_FD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+    {
+        throw ProcessException("Failed to create pool notification: " + std::string(std::strerror(errno)) + " (" + std::to_string(errno) + ")!");
+    }
+}
 
 PoolCondition::~PoolCondition() noexcept
-{}
+{
+    close(i_FD);
+}
 
 //*************************************************************************************
 // Notify
 //*************************************************************************************
 
-void PoolCondition::Notify() noexcept
+void PoolCondition::Notify(MRH_Uint32 u32_Count) noexcept
 {
-    c_Condition.notify_one();
+    // Add work before signaling, the waiting thread takes both
+    u64_Pending.fetch_add(u32_Count);
+    
+    // Only signal once until cleared
+    if (b_Signaled.exchange(true) == true)
+    {
+        return;
+    }
+    
+    if (eventfd_write(i_FD, 1) < 0)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Could not notify pool: " +
+                                                 std::string(std::strerror(errno)) +
+                                                 " (" +
+                                                 std::to_string(errno) +
+                                                 ")!",
+                                "PoolCondition.cpp", __LINE__);
+    }
 }
 
 //*************************************************************************************
 // Wait
 //*************************************************************************************
 
-void PoolCondition::Wait() noexcept
+MRH_Uint64 PoolCondition::Wait() noexcept
 {
-    std::unique_lock<std::mutex> c_UniqueLock(c_Mutex);
-    c_Condition.wait(c_UniqueLock);
+    struct pollfd c_PollFD;
+    c_PollFD.fd = i_FD;
+    c_PollFD.events = POLLIN;
+    
+    poll(&c_PollFD, 1, -1);
+    
+    return Clear();
 }
 
-void PoolCondition::Wait(MRH_Sint32 s32_TimeoutMS) noexcept
+MRH_Uint64 PoolCondition::Wait(MRH_Sint32 s32_TimeoutMS) noexcept
 {
     if (s32_TimeoutMS <= 0)
     {
-        return;
+        return Clear();
     }
     
-    std::unique_lock<std::mutex> c_UniqueLock(c_Mutex);
-    c_Condition.wait_for(c_UniqueLock, std::chrono::milliseconds(s32_TimeoutMS));
+    struct pollfd c_PollFD;
+    c_PollFD.fd = i_FD;
+    c_PollFD.events = POLLIN;
+    
+    poll(&c_PollFD, 1, s32_TimeoutMS);
+    
+    return Clear();
+}
+
+MRH_Uint64 PoolCondition::Clear() noexcept
+{
+    // Reset the file descriptor before allowing new signals,
+    // work added afterwards signals again
+    eventfd_t u64_Value;
+    eventfd_read(i_FD, &u64_Value);
+    
+    b_Signaled.store(false);
+    
+    return u64_Pending.exchange(0);
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+int PoolCondition::GetFD() const noexcept
+{
+    return i_FD;
 }
@@ -14,12 +14,12 @@
  *  limitations under the License.
  */
 
+ 
 #ifndef PoolCondition_h
 #define PoolCondition_h
 
 // C / C++
-#include <condition_variable>
-#include <mutex>
+#include <atomic>
 
 // External
 #include <MRH_Typedefs.h>
@@ -29,8 +29,6 @@
 
 class PoolCondition
 {
-    friend class ServicePool;
-    
 public:
     
     //*************************************************************************************
@@ -41,7 +39,15 @@ public:
      *  Default constructor.
      */
     
-    PoolCondition() noexcept;
+    PoolCondition();
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_PoolCondition PoolCondition class source.
+     */
+    
+    PoolCondition(PoolCondition const& c_PoolCondition) = delete;
     
     /**
      *  Default destructor.
@@ -54,12 +60,13 @@ public:
     //*************************************************************************************
     
     /**
-     *  Notify a waiting thread. This function is thread safe.
+     *  Notify a waiting thread. Notifications are combined until the waiting
+     *  thread wakes up. This function is thread safe.
+     *
+     *  \param u32_Count The amount of new pending work.
      */
     
-    void Notify() noexcept;
-    
-private:
+    void Notify(MRH_Uint32 u32_Count) noexcept;
     
     //*************************************************************************************
     // Wait
@@ -67,24 +74,53 @@ private:
     
     /**
      *  Wait for a notification. This function is thread safe.
+     *
+     *  \return The amount of pending work.
      */
     
-    void Wait() noexcept;
+    MRH_Uint64 Wait() noexcept;
     
     /**
      *  Wait for a notification until time expires. This function is thread safe.
      *
      *  \param s32_TimeoutMS The timeout in milliseconds.
+     *
+     *  \return The amount of pending work, 0 if the wait timed out.
+     */
+    
+    MRH_Uint64 Wait(MRH_Sint32 s32_TimeoutMS) noexcept;
+    
+    /**
+     *  Clear the notification. This function has to be called after the
+     *  notification file descriptor was polled. This function is thread safe.
+     *
+     *  \return The amount of pending work.
      */
     
-    void Wait(MRH_Sint32 s32_TimeoutMS) noexcept;
+    MRH_Uint64 Clear() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the notification file descriptor. The file descriptor becomes
+     *  readable once notified. This function is thread safe.
+     *
+     *  \return The notification file descriptor.
+     */
+    
+    int GetFD() const noexcept;
+
+private:
     
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
-    std::condition_variable c_Condition;
-    std::mutex c_Mutex;
+    int i_FD;
+    std::atomic<bool> b_Signaled;
+    std::atomic<MRH_Uint64> u64_Pending;
     
 protected:
     
@@ -15,18 +15,29 @@
  */
 
 // C / C++
+#include <iterator>
 
 // External
 
 // Project
 #include "./PoolEvents.h"
 
+// Pre-defined
+namespace
+{
+    // Slots for each direction, more events wait in the ring overflow
+    constexpr size_t us_RingSize = 512;
+}
+
 
 //*************************************************************************************
 // Constructor / Destructor
 //*************************************************************************************
 
-PoolEvents::PoolEvents() noexcept
+PoolEvents::PoolEvents(bool b_MultiSender, bool b_SwapRecieved) : p_Ring{ { us_RingSize, b_MultiSender },
+                                                                          { (b_SwapRecieved == true ? 1 : us_RingSize), false } },
+                                                                  us_SwapSize(0),
+                                                                  b_SwapRecieved(b_SwapRecieved)
 {}
 
 PoolEvents::~PoolEvents() noexcept
@@ -36,19 +47,65 @@ PoolEvents::~PoolEvents() noexcept
 // Recieve
 //*************************************************************************************
 
-void PoolEvents::LockRecievedEvents() noexcept
+size_t PoolEvents::RetrieveEvents(std::vector<Event>& v_Event) noexcept
 {
-    p_Mutex[RECIEVED].lock();
+    size_t us_Start = v_Event.size();
+    
+    p_Ring[RECIEVED].Take(v_Event);
+    
+    // Swapped buffers are published by the pool update
+    if (us_SwapSize.load(std::memory_order_acquire) > 0)
+    {
+        c_SwapMutex.lock();
+        
+        if (v_Event.size() == 0)
+        {
+            v_Event.swap(v_Swap);
+        }
+        else
+        {
+            std::move(v_Swap.begin(), v_Swap.end(), std::back_inserter(v_Event));
+            v_Swap.clear();
+        }
+        
+        us_SwapSize.store(0, std::memory_order_relaxed);
+        c_SwapMutex.unlock();
+    }
+    
+    return v_Event.size() - us_Start;
 }
 
-void PoolEvents::UnlockRecievedEvents() noexcept
+size_t PoolEvents::SwapRecievedEvents(std::vector<Event>& v_Event) noexcept
 {
-    p_Mutex[RECIEVED].unlock();
+    // Cleared buffer keeps its capacity for the publisher
+    v_Event.clear();
+    
+    return RetrieveEvents(v_Event);
 }
 
-std::vector<Event>& PoolEvents::RetrieveEvents() noexcept
+void PoolEvents::PublishRecievedEvents(std::vector<Event>& v_Event) noexcept
 {
-    return p_Queue[RECIEVED];
+    if (v_Event.size() == 0)
+    {
+        return;
+    }
+    
+    c_SwapMutex.lock();
+    
+    // Take the buffer returned by the consumer if the last one was retrieved
+    if (v_Swap.size() == 0)
+    {
+        v_Swap.swap(v_Event);
+    }
+    else
+    {
+        std::move(v_Event.begin(), v_Event.end(), std::back_inserter(v_Swap));
+    }
+    
+    us_SwapSize.store(v_Swap.size(), std::memory_order_release);
+    c_SwapMutex.unlock();
+    
+    v_Event.clear();
 }
 
 //*************************************************************************************
@@ -57,9 +114,28 @@ std::vector<Event>& PoolEvents::RetrieveEvents() noexcept
 
 void PoolEvents::SendEvents(std::vector<Event>& v_Event) noexcept
 {
-    p_Mutex[SEND].lock();
-    std::move(v_Event.begin(), v_Event.end(), std::back_inserter(p_Queue[SEND]));
-    p_Mutex[SEND].unlock();
+    p_Ring[SEND].Push(v_Event);
+}
+
+//*************************************************************************************
+// Statistics
+//*************************************************************************************
+
+void PoolEvents::LogStatistics(std::string const& s_Name) const noexcept
+{
+    p_Ring[SEND].LogStatistics(s_Name + " send");
     
-    v_Event.clear();
+    if (b_SwapRecieved == false)
+    {
+        p_Ring[RECIEVED].LogStatistics(s_Name + " recieved");
+    }
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+size_t PoolEvents::GetRecievedDepth() const noexcept
+{
+    return p_Ring[RECIEVED].GetDepth() + us_SwapSize.load(std::memory_order_relaxed);
 }
@@ -18,6 +18,7 @@
 #define PoolEvents_h
 
 // C / C++
+#include <atomic>
 #include <mutex>
 #include <vector>
 
@@ -25,6 +26,7 @@
 #include "../../Event/Event.h"
 
 // Project
+#include "./PoolRing.h"
 
 
 class PoolEvents
@@ -46,24 +48,27 @@ public:
     //*************************************************************************************
 
     /**
-     *  Lock the recieved event queue. This function is thread safe.
-     */
-    
-    void LockRecievedEvents() noexcept;
-    
-    /**
-     *  Unlock the recieved event queue. This function is thread safe.
+     *  Retrieve recieved events. This function may only be called by the
+     *  recieved event consumer.
+     *
+     *  \param v_Event The vector to append the recieved events to.
+     *
+     *  \return The amount of retrieved events.
      */
     
-    void UnlockRecievedEvents() noexcept;
+    size_t RetrieveEvents(std::vector<Event>& v_Event) noexcept;
     
     /**
-     *  Retrieve recieved events. This function is thread safe.
+     *  Exchange a empty buffer for the recieved events. The given buffer is
+     *  cleared and kept for the next recieved events, no events are copied.
+     *  This function may only be called by the recieved event consumer.
+     *
+     *  \param v_Event The buffer to exchange, replaced by the recieved events.
      *
-     *  \return A vector containing all read events.
+     *  \return The amount of retrieved events.
      */
     
-    std::vector<Event>& RetrieveEvents() noexcept;
+    size_t SwapRecievedEvents(std::vector<Event>& v_Event) noexcept;
 
     //*************************************************************************************
     // Send
@@ -75,7 +80,32 @@ public:
      *  \param v_Event The events to send. The events will be moved an the vector cleared.
      */
 
-    void SendEvents(std::vector<Event>& v_Event) noexcept;
+    virtual void SendEvents(std::vector<Event>& v_Event) noexcept;
+    
+    //*************************************************************************************
+    // Statistics
+    //*************************************************************************************
+    
+    /**
+     *  Log the event queue statistics. This function is thread safe.
+     *
+     *  \param s_Name The queue owner name used for logging.
+     */
+    
+    void LogStatistics(std::string const& s_Name) const noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of events waiting to be retrieved. This function is
+     *  thread safe.
+     *
+     *  \return The recieved queue depth.
+     */
+    
+    size_t GetRecievedDepth() const noexcept;
     
 private:
 
@@ -106,9 +136,13 @@ protected:
     
     /**
      *  Default constructor.
+     *
+     *  \param b_MultiSender If more than one thread adds events to send.
+     *  \param b_SwapRecieved If recieved events are published by swapping buffers
+     *                        instead of using the recieved ring.
      */
     
-    PoolEvents() noexcept;
+    PoolEvents(bool b_MultiSender, bool b_SwapRecieved);
     
     /**
      *  Copy constructor. Disabled for this class.
@@ -118,17 +152,38 @@ protected:
     
     PoolEvents(PoolEvents const& c_PoolEvents) = delete;
     
+    //*************************************************************************************
+    // Recieve
+    //*************************************************************************************
+    
+    /**
+     *  Publish recieved events for the consumer by swapping buffers. The events are
+     *  appended if the consumer did not take the last buffer yet.
+     *
+     *  \param v_Event The recieved events. The vector is replaced by a empty buffer.
+     */
+    
+    void PublishRecievedEvents(std::vector<Event>& v_Event) noexcept;
+    
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
-    // Thread pool safety
-    std::mutex p_Mutex[QUEUE_TYPE_COUNT];
+    // Event handoff between threads
+    // @NOTE: Send events are added by the pool or core and taken by the
+    //        update thread, recieved events are added by the update thread
+    //        and taken by the pool or core
+    PoolRing p_Ring[QUEUE_TYPE_COUNT];
     
-    // Event storage
-    // @NOTE: We store both here instead of giving them directly to the destination
-    //        This is done to minimize wait times for mutexes
+    // Events taken from or collected for the rings
+    // @NOTE: Only used by the update thread
     std::vector<Event> p_Queue[QUEUE_TYPE_COUNT];
+    
+    // Recieved buffer exchanged with the consumer
+    std::mutex c_SwapMutex;
+    std::vector<Event> v_Swap;
+    std::atomic<size_t> us_SwapSize;
+    bool b_SwapRecieved;
 };
 
 #endif /* PoolEvents_h */
@@ -0,0 +1,577 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+// External
+
+// Project
+#include "./PoolReactor.h"
+#include "./PoolService.h"
+#include "../ProcessException.h"
+#include "../../Configuration/CoreConfiguration.h"
+#include "../../Logger/Logger.h"
+
+// Pre-defined
+namespace
+{
+    // Max poll results handled per update
+    constexpr int i_PollEventCount = 64;
+}
+
+
+//*************************************************************************************
+// Worker
+//*************************************************************************************
+
+class PoolReactor::Worker
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    Worker() noexcept : i_PollFD(-1),
+                        i_WakeFD(-1),
+                        b_Run(false)
+    {}
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~Worker() noexcept
+    {
+        if (i_PollFD > -1)
+        {
+            close(i_PollFD);
+        }
+        
+        if (i_WakeFD > -1)
+        {
+            close(i_WakeFD);
+        }
+    }
+    
+    //*************************************************************************************
+    // Wake
+    //*************************************************************************************
+    
+    /**
+     *  Wake the worker thread. This function is thread safe.
+     */
+    
+    void Wake() noexcept
+    {
+        if (eventfd_write(i_WakeFD, 1) < 0)
+        {
+            Logger::Singleton().Log(Logger::WARNING, "Could not wake reactor thread: " +
+                                                     std::string(std::strerror(errno)) +
+                                                     " (" +
+                                                     std::to_string(errno) +
+                                                     ")!",
+                                    "PoolReactor.cpp", __LINE__);
+        }
+    }
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // Poll
+    int i_PollFD;
+    int i_WakeFD;
+    
+    // Thread
+    std::thread c_Thread;
+    std::atomic<bool> b_Run;
+    
+    // Services, locked while updating
+    std::mutex c_Mutex;
+    std::vector<std::unique_ptr<Entry>> v_Entry;
+    
+    // Services with new send events
+    std::mutex c_NotifyMutex;
+    std::vector<Entry*> v_Notified;
+};
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+PoolReactor::PoolReactor() noexcept
+{
+    MRH_Uint32 u32_ThreadCount = CoreConfiguration::Singleton().GetServiceReactorThreads();
+    
+    try
+    {
+        for (MRH_Uint32 i = 0; i < u32_ThreadCount; ++i)
+        {
+            std::unique_ptr<Worker> p_Worker(new Worker());
+            
+            if ((p_Worker->i_PollFD = epoll_create1(EPOLL_CLOEXEC)) < 0 ||
+                (p_Worker->i_WakeFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+            {
+                throw ProcessException("Failed to create reactor poll: " + std::string(std::strerror(errno)) + " (" + std::to_string(errno) + ")!");
+            }
+            
+            // Wake events have no entry
+            struct epoll_event c_Event;
+            c_Event.events = EPOLLIN;
+            c_Event.data.ptr = NULL;
+            
+            if (epoll_ctl(p_Worker->i_PollFD, EPOLL_CTL_ADD, p_Worker->i_WakeFD, &c_Event) < 0)
+            {
+                throw ProcessException("Failed to add reactor wake: " + std::string(std::strerror(errno)) + " (" + std::to_string(errno) + ")!");
+            }
+            
+            p_Worker->b_Run = true;
+            p_Worker->c_Thread = std::thread(Update, p_Worker.get());
+            
+            v_Worker.emplace_back(std::move(p_Worker));
+        }
+    }
+    catch (ProcessException& e)
+    {
+        Logger::Singleton().Log(Logger::WARNING, e.what2() + " Using service threads.",
+                                "PoolReactor.cpp", __LINE__);
+        Stop();
+    }
+    catch (std::exception& e)
+    {
+        Logger::Singleton().Log(Logger::WARNING, "Failed to start reactor thread: " +
+                                                 std::string(e.what()) +
+                                                 " Using service threads.",
+                                "PoolReactor.cpp", __LINE__);
+        Stop();
+    }
+    
+    if (v_Worker.size() > 0)
+    {
+        Logger::Singleton().Log(Logger::INFO, "Updating services with " +
+                                              std::to_string(v_Worker.size()) +
+                                              " reactor threads.",
+                                "PoolReactor.cpp", __LINE__);
+    }
+}
+
+PoolReactor::~PoolReactor() noexcept
+{
+    Stop();
+}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+PoolReactor& PoolReactor::Singleton() noexcept
+{
+    static PoolReactor c_PoolReactor;
+    return c_PoolReactor;
+}
+
+//*************************************************************************************
+// Stop
+//*************************************************************************************
+
+void PoolReactor::Stop() noexcept
+{
+    for (auto& Worker : v_Worker)
+    {
+        Worker->b_Run = false;
+        Worker->Wake();
+        
+        if (Worker->c_Thread.joinable() == true)
+        {
+            Worker->c_Thread.join();
+        }
+    }
+    
+    v_Worker.clear();
+}
+
+//*************************************************************************************
+// Service
+//*************************************************************************************
+
+PoolReactor::Entry* PoolReactor::Add(PoolService* p_Service)
+{
+    if (v_Worker.size() == 0)
+    {
+        throw ProcessException("Service reactor is not running!");
+    }
+    
+    std::shared_ptr<ServiceProcess> const& p_Process = p_Service->GetProcess();
+    
+    // Only pollable sources can be updated by the reactor
+    std::unique_ptr<Entry> p_Entry(new Entry());
+    p_Entry->p_Service = p_Service;
+    p_Entry->b_Recieve = p_Process->GetCanSend();
+    p_Entry->b_Send = p_Process->GetCanRecieve();
+    p_Entry->i_RecieveFD = (p_Entry->b_Recieve == true ? p_Process->GetRecievePollFD() : -1);
+    p_Entry->i_SendFD = (p_Entry->b_Send == true ? p_Process->GetSendPollFD() : -1);
+    p_Entry->b_SendPoll = false;
+    p_Entry->b_RecieveThrottled = false;
+    p_Entry->b_RecievePending = p_Entry->b_Recieve; // Arm poll on first update
+    p_Entry->b_SendPending = false;
+    p_Entry->b_HungUp = false;
+    p_Entry->b_Notified = false;
+    p_Entry->b_Removed = false;
+    
+    if (p_Entry->b_Recieve == true && p_Entry->i_RecieveFD < 0)
+    {
+        throw ProcessException("Service event source can not be polled!");
+    }
+    
+    // Balance by service count
+    Worker* p_Worker = NULL;
+    size_t us_Count = 0;
+    
+    for (auto& Worker : v_Worker)
+    {
+        Worker->c_Mutex.lock();
+        
+        if (p_Worker == NULL || Worker->v_Entry.size() < us_Count)
+        {
+            p_Worker = Worker.get();
+            us_Count = Worker->v_Entry.size();
+        }
+        
+        Worker->c_Mutex.unlock();
+    }
+    
+    p_Entry->p_Worker = p_Worker;
+    
+    // Register, level triggered
+    Entry* p_Result = p_Entry.get();
+    
+    p_Worker->c_Mutex.lock();
+    
+    if (p_Entry->i_RecieveFD > -1)
+    {
+        struct epoll_event c_Event;
+        c_Event.events = EPOLLIN;
+        c_Event.data.ptr = p_Result;
+        
+        if (epoll_ctl(p_Worker->i_PollFD, EPOLL_CTL_ADD, p_Entry->i_RecieveFD, &c_Event) < 0)
+        {
+            int i_Error = errno;
+            p_Worker->c_Mutex.unlock();
+            throw ProcessException("Failed to add service to reactor: " + std::string(std::strerror(i_Error)) + " (" + std::to_string(i_Error) + ")!");
+        }
+    }
+    
+    p_Worker->v_Entry.emplace_back(std::move(p_Entry));
+    p_Worker->c_Mutex.unlock();
+    
+    p_Worker->Wake();
+    
+    return p_Result;
+}
+
+void PoolReactor::Remove(Entry* p_Entry) noexcept
+{
+    Worker* p_Worker = p_Entry->p_Worker;
+    
+    // Poll results still returned are ignored, the worker
+    // releases the entry after the current update
+    p_Worker->c_Mutex.lock();
+    
+    if (p_Entry->i_RecieveFD > -1 && p_Entry->b_RecieveThrottled == false)
+    {
+        epoll_ctl(p_Worker->i_PollFD, EPOLL_CTL_DEL, p_Entry->i_RecieveFD, NULL);
+    }
+    
+    if (p_Entry->b_SendPoll == true)
+    {
+        epoll_ctl(p_Worker->i_PollFD, EPOLL_CTL_DEL, p_Entry->i_SendFD, NULL);
+    }
+    
+    p_Entry->b_Removed = true;
+    p_Worker->c_Mutex.unlock();
+    
+    p_Worker->Wake();
+}
+
+void PoolReactor::Notify(Entry* p_Entry) noexcept
+{
+    // Notify once until the worker updated the service
+    if (p_Entry->b_Send == false || p_Entry->b_Notified.exchange(true) == true)
+    {
+        return;
+    }
+    
+    Worker* p_Worker = p_Entry->p_Worker;
+    
+    p_Worker->c_NotifyMutex.lock();
+    p_Worker->v_Notified.emplace_back(p_Entry);
+    p_Worker->c_NotifyMutex.unlock();
+    
+    p_Worker->Wake();
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void PoolReactor::Update(Worker* p_Worker) noexcept
+{
+    struct epoll_event p_Event[i_PollEventCount];
+    std::vector<Entry*> v_Notified;
+    Entry* p_Entry;
+    int i_TimeoutMS = -1;
+    int i_Count;
+    
+    while (p_Worker->b_Run == true)
+    {
+        // Wait for services to become ready
+        if ((i_Count = epoll_wait(p_Worker->i_PollFD, p_Event, i_PollEventCount, i_TimeoutMS)) < 0)
+        {
+            if (errno != EINTR)
+            {
+                Logger::Singleton().Log(Logger::WARNING, "Could not poll reactor: " +
+                                                         std::string(std::strerror(errno)) +
+                                                         " (" +
+                                                         std::to_string(errno) +
+                                                         ")!",
+                                        "PoolReactor.cpp", __LINE__);
+            }
+            
+            i_Count = 0;
+        }
+        
+        p_Worker->c_Mutex.lock();
+        
+        // Mark ready services
+        for (int i = 0; i < i_Count; ++i)
+        {
+            if ((p_Entry = static_cast<Entry*>(p_Event[i].data.ptr)) == NULL)
+            {
+                eventfd_t u64_Value;
+                eventfd_read(p_Worker->i_WakeFD, &u64_Value);
+                continue;
+            }
+            else if (p_Entry->b_Removed == true)
+            {
+                continue;
+            }
+            
+            if (p_Event[i].events & (EPOLLERR | EPOLLHUP))
+            {
+                p_Entry->b_HungUp = true;
+            }
+            
+            if (p_Event[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            {
+                p_Entry->b_RecievePending = p_Entry->b_Recieve;
+            }
+            
+            if (p_Event[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+            {
+                p_Entry->b_SendPending = p_Entry->b_Send;
+            }
+        }
+        
+        p_Worker->c_NotifyMutex.lock();
+        v_Notified.swap(p_Worker->v_Notified);
+        p_Worker->c_NotifyMutex.unlock();
+        
+        for (auto& Entry : v_Notified)
+        {
+            // Reset first, new events during the update notify again
+            Entry->b_Notified = false;
+            Entry->b_SendPending = !(Entry->b_HungUp);
+        }
+        
+        v_Notified.clear();
+        
+        // Update ready services and find the next timeout
+        // @NOTE: Sources without poll support are retried after the service timeout
+        i_TimeoutMS = -1;
+        
+        for (auto& Entry : p_Worker->v_Entry)
+        {
+            if (Entry->b_Removed == true)
+            {
+                continue;
+            }
+            
+            if (Entry->b_RecievePending == true || Entry->b_SendPending == true)
+            {
+                UpdateService(Entry.get());
+            }
+            
+            // Remaining events were read, the service is removed once the
+            // process stopped
+            if (Entry->b_HungUp == true && (Entry->i_RecieveFD > -1 || Entry->i_SendFD > -1))
+            {
+                StopPoll(Entry.get());
+            }
+            
+            if (Entry->b_RecievePending == true && Entry->b_RecieveThrottled == false)
+            {
+                i_TimeoutMS = 0;
+            }
+            else if (Entry->b_SendPending == true || Entry->b_RecieveThrottled == true)
+            {
+                MRH_Sint32 s32_RetryMS = std::max(Entry->p_Service->s32_TimeoutMS, 1);
+                
+                if (i_TimeoutMS < 0 || s32_RetryMS < i_TimeoutMS)
+                {
+                    i_TimeoutMS = s32_RetryMS;
+                }
+            }
+        }
+        
+        // No poll result references removed services anymore
+        p_Worker->v_Entry.erase(std::remove_if(p_Worker->v_Entry.begin(),
+                                               p_Worker->v_Entry.end(),
+                                               [](std::unique_ptr<Entry> const& Removed) { return Removed->b_Removed; }),
+                                p_Worker->v_Entry.end());
+        
+        p_Worker->c_Mutex.unlock();
+    }
+}
+
+void PoolReactor::UpdateService(Entry* p_Entry) noexcept
+{
+    PoolService* p_Service = p_Entry->p_Service;
+    
+    // Stop polling while throttled, the readable source would wake us constantly
+    if (p_Entry->b_RecievePending == true && p_Service->GetRecieveThrottled() != p_Entry->b_RecieveThrottled)
+    {
+        bool b_Throttled = !(p_Entry->b_RecieveThrottled);
+        
+        struct epoll_event c_Event;
+        c_Event.events = EPOLLIN;
+        c_Event.data.ptr = p_Entry;
+        
+        if (epoll_ctl(p_Entry->p_Worker->i_PollFD, (b_Throttled == true ? EPOLL_CTL_DEL : EPOLL_CTL_ADD), p_Entry->i_RecieveFD, &c_Event) < 0)
+        {
+            Logger::Singleton().Log(Logger::WARNING, "Could not change service recieve poll: " +
+                                                     std::string(std::strerror(errno)) +
+                                                     " (" +
+                                                     std::to_string(errno) +
+                                                     ")!",
+                                    "PoolReactor.cpp", __LINE__);
+        }
+        else
+        {
+            p_Entry->b_RecieveThrottled = b_Throttled;
+        }
+    }
+    
+    // Read all available events, wait for more afterwards
+    // @NOTE: Throttled services keep the recieve pending and are retried after the timeout
+    if (p_Entry->b_RecievePending == true && p_Entry->b_RecieveThrottled == false)
+    {
+        size_t us_Recieved = p_Service->UpdateRecieve(0);
+        
+        if (us_Recieved > 0)
+        {
+            p_Service->p_Condition->Notify(static_cast<MRH_Uint32>(us_Recieved));
+        }
+        
+        p_Entry->b_RecievePending = !(p_Service->p_Process->PrepareRecievePoll());
+    }
+    
+    // Send and only poll for write space while events are left
+    if (p_Entry->b_SendPending == true)
+    {
+        bool b_Pending = p_Service->UpdateSend();
+        
+        if (p_Entry->i_SendFD < 0)
+        {
+            p_Entry->b_SendPending = b_Pending;
+        }
+        else
+        {
+            p_Entry->b_SendPending = false;
+            
+            if (b_Pending != p_Entry->b_SendPoll)
+            {
+                struct epoll_event c_Event;
+                c_Event.events = EPOLLOUT;
+                c_Event.data.ptr = p_Entry;
+                
+                if (epoll_ctl(p_Entry->p_Worker->i_PollFD, (b_Pending == true ? EPOLL_CTL_ADD : EPOLL_CTL_DEL), p_Entry->i_SendFD, &c_Event) < 0)
+                {
+                    Logger::Singleton().Log(Logger::WARNING, "Could not change service send poll: " +
+                                                             std::string(std::strerror(errno)) +
+                                                             " (" +
+                                                             std::to_string(errno) +
+                                                             ")!",
+                                            "PoolReactor.cpp", __LINE__);
+                    
+                    // Retry without poll
+                    p_Entry->b_SendPending = b_Pending;
+                }
+                else
+                {
+                    p_Entry->b_SendPoll = b_Pending;
+                }
+            }
+        }
+    }
+}
+
+void PoolReactor::StopPoll(Entry* p_Entry) noexcept
+{
+    if (p_Entry->i_RecieveFD > -1 && p_Entry->b_RecieveThrottled == false)
+    {
+        epoll_ctl(p_Entry->p_Worker->i_PollFD, EPOLL_CTL_DEL, p_Entry->i_RecieveFD, NULL);
+    }
+    
+    if (p_Entry->b_SendPoll == true)
+    {
+        epoll_ctl(p_Entry->p_Worker->i_PollFD, EPOLL_CTL_DEL, p_Entry->i_SendFD, NULL);
+    }
+    
+    // Nothing is pending or registered anymore, Remove() skips the poll
+    p_Entry->i_RecieveFD = -1;
+    p_Entry->i_SendFD = -1;
+    p_Entry->b_SendPoll = false;
+    p_Entry->b_RecieveThrottled = false;
+    p_Entry->b_Recieve = false;
+    p_Entry->b_RecievePending = false;
+    p_Entry->b_SendPending = false;
+    
+    Logger::Singleton().Log(Logger::INFO, "Service " +
+                                          p_Entry->p_Service->p_Process->GetRunPath() +
+                                          " closed its event source, no longer polled.",
+                            "PoolReactor.cpp", __LINE__);
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+bool PoolReactor::GetEnabled() const noexcept
+{
+    return v_Worker.size() > 0;
+}
@@ -0,0 +1,214 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+ 
+#ifndef PoolReactor_h
+#define PoolReactor_h
+
+// C / C++
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <memory>
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+
+
+class PoolService;
+
+
+class PoolReactor
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    class Worker;
+    
+    // @NOTE: Owned by the worker updating the service. Entries are released
+    //        by the worker once no returned poll event can reference them.
+    class Entry
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        PoolService* p_Service;
+        Worker* p_Worker;
+        
+        // Poll
+        int i_RecieveFD;
+        int i_SendFD;
+        bool b_SendPoll; // Write interest enabled
+        bool b_RecieveThrottled; // Read interest disabled by the pool throttle
+        
+        // Update state, only used by the worker
+        bool b_Recieve;
+        bool b_Send;
+        bool b_RecievePending; // Events readable without poll result
+        bool b_SendPending; // Send queue not empty, no poll available
+        bool b_HungUp; // Source closed by the process, poll interest removed after the update
+        
+        // Thread safe state
+        std::atomic<bool> b_Notified;
+        bool b_Removed; // Worker mutex
+    };
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_PoolReactor PoolReactor class source.
+     */
+    
+    PoolReactor(PoolReactor const& c_PoolReactor) = delete;
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance. This function is thread safe.
+     *
+     *  \return The class instance.
+     */
+    
+    static PoolReactor& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Service
+    //*************************************************************************************
+    
+    /**
+     *  Add a service to the worker with the fewest services. This function
+     *  is thread safe.
+     *
+     *  \param p_Service The service to update.
+     *
+     *  \return The service entry.
+     */
+    
+    Entry* Add(PoolService* p_Service);
+    
+    /**
+     *  Remove a service. The service is no longer updated once this function
+     *  returns. This function is thread safe.
+     *
+     *  \param p_Entry The service entry to remove.
+     */
+    
+    void Remove(Entry* p_Entry) noexcept;
+    
+    /**
+     *  Notify the worker of a service that new events can be sent. This
+     *  function is thread safe.
+     *
+     *  \param p_Entry The service entry to notify.
+     */
+    
+    void Notify(Entry* p_Entry) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if services are updated by the reactor. This function is thread safe.
+     *
+     *  \return true if the reactor is used, false if each service uses its own thread.
+     */
+    
+    bool GetEnabled() const noexcept;
+
+private:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    PoolReactor() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~PoolReactor() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Update the services of a worker.
+     *
+     *  \param p_Worker The worker to update.
+     */
+    
+    static void Update(Worker* p_Worker) noexcept;
+    
+    /**
+     *  Update a single service.
+     *
+     *  \param p_Entry The service entry to update.
+     */
+    
+    static void UpdateService(Entry* p_Entry) noexcept;
+    
+    /**
+     *  Stop polling a service with a closed source. A closed source stays
+     *  ready and would wake the worker constantly.
+     *
+     *  \param p_Entry The service entry to stop polling.
+     */
+    
+    static void StopPoll(Entry* p_Entry) noexcept;
+    
+    //*************************************************************************************
+    // Stop
+    //*************************************************************************************
+    
+    /**
+     *  Stop and remove all workers.
+     */
+    
+    void Stop() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::vector<std::unique_ptr<Worker>> v_Worker;
+
+protected:
+
+};
+
+#endif /* PoolReactor_h */
@@ -0,0 +1,272 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+#include <iterator>
+
+// External
+
+// Project
+#include "./PoolRing.h"
+#include "../ProcessException.h"
+#include "../../Logger/Logger.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+PoolRing::PoolRing(size_t us_Size, bool b_MultiProducer) : us_Size(1),
+                                                           b_MultiProducer(b_MultiProducer),
+                                                           us_Tail(0),
+                                                           us_Head(0),
+                                                           b_Overflow(false),
+                                                           us_OverflowSize(0),
+                                                           us_MaxDepth(0),
+                                                           u64_OverflowEvents(0),
+                                                           u64_Contention(0)
+{
+    // Power of two size, positions are masked
+    while (this->us_Size < us_Size)
+    {
+        this->us_Size <<= 1;
+    }
+    
+    us_Mask = this->us_Size - 1;
+    
+    try
+    {
+        p_Slot = std::unique_ptr<Slot[]>(new Slot[this->us_Size]);
+    }
+    catch (std::exception& e)
+    {
+        throw ProcessException("Failed to allocate pool ring: " + std::string(e.what()));
+    }
+}
+
+PoolRing::~PoolRing() noexcept
+{}
+
+//*************************************************************************************
+// Producer
+//*************************************************************************************
+
+size_t PoolRing::Reserve(size_t us_Count, size_t& us_Pos) noexcept
+{
+    us_Pos = us_Tail.load(std::memory_order_relaxed);
+    
+    while (true)
+    {
+        // Slots before the head were moved out by the consumer
+        size_t us_Used = us_Pos - us_Head.load(std::memory_order_acquire);
+        
+        if (us_Used > us_Size)
+        {
+            // Outdated position, other producers reserved and the consumer took
+            us_Pos = us_Tail.load(std::memory_order_relaxed);
+            continue;
+        }
+        
+        size_t us_Reserved = us_Size - us_Used;
+        
+        if (us_Reserved > us_Count)
+        {
+            us_Reserved = us_Count;
+        }
+        
+        if (us_Reserved == 0)
+        {
+            return 0;
+        }
+        else if (b_MultiProducer == false)
+        {
+            us_Tail.store(us_Pos + us_Reserved, std::memory_order_relaxed);
+            return us_Reserved;
+        }
+        else if (us_Tail.compare_exchange_weak(us_Pos, us_Pos + us_Reserved, std::memory_order_relaxed) == true)
+        {
+            return us_Reserved;
+        }
+        
+        u64_Contention.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void PoolRing::Push(std::vector<Event>& v_Event) noexcept
+{
+    size_t us_Count = v_Event.size();
+    size_t us_Pushed = 0;
+    size_t us_Pos;
+    
+    if (us_Count == 0)
+    {
+        return;
+    }
+    
+    // Ring first, unless earlier events are still waiting in the overflow
+    if (b_Overflow.load(std::memory_order_acquire) == false)
+    {
+        us_Pushed = Reserve(us_Count, us_Pos);
+        
+        for (size_t i = 0; i < us_Pushed; ++i)
+        {
+            Slot& c_Slot = p_Slot[(us_Pos + i) & us_Mask];
+            
+            c_Slot.c_Event = std::move(v_Event[i]);
+            c_Slot.us_Sequence.store(us_Pos + i + 1, std::memory_order_release);
+        }
+    }
+    
+    if (us_Pushed < us_Count)
+    {
+        c_OverflowMutex.lock();
+        std::move(v_Event.begin() + us_Pushed, v_Event.end(), std::back_inserter(v_Overflow));
+        us_OverflowSize.store(v_Overflow.size(), std::memory_order_relaxed);
+        b_Overflow.store(true, std::memory_order_release);
+        c_OverflowMutex.unlock();
+        
+        u64_OverflowEvents.fetch_add(us_Count - us_Pushed, std::memory_order_relaxed);
+    }
+    
+    v_Event.clear();
+    
+    UpdateStatistics();
+}
+
+void PoolRing::Push(Event const& c_Event) noexcept
+{
+    size_t us_Pos;
+    
+    if (b_Overflow.load(std::memory_order_acquire) == false && Reserve(1, us_Pos) == 1)
+    {
+        Slot& c_Slot = p_Slot[us_Pos & us_Mask];
+        
+        c_Slot.c_Event = c_Event;
+        c_Slot.us_Sequence.store(us_Pos + 1, std::memory_order_release);
+    }
+    else
+    {
+        c_OverflowMutex.lock();
+        v_Overflow.emplace_back(c_Event);
+        us_OverflowSize.store(v_Overflow.size(), std::memory_order_relaxed);
+        b_Overflow.store(true, std::memory_order_release);
+        c_OverflowMutex.unlock();
+        
+        u64_OverflowEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    UpdateStatistics();
+}
+
+//*************************************************************************************
+// Consumer
+//*************************************************************************************
+
+size_t PoolRing::Take(std::vector<Event>& v_Event) noexcept
+{
+    size_t us_Pos = us_Head.load(std::memory_order_relaxed);
+    size_t us_Start = v_Event.size();
+    
+    // Take published slots in order, reserved but unpublished slots
+    // end the batch
+    while (true)
+    {
+        Slot& c_Slot = p_Slot[us_Pos & us_Mask];
+        
+        if (c_Slot.us_Sequence.load(std::memory_order_acquire) != us_Pos + 1)
+        {
+            break;
+        }
+        
+        v_Event.emplace_back(std::move(c_Slot.c_Event));
+        ++us_Pos;
+    }
+    
+    // Free all taken slots at once
+    us_Head.store(us_Pos, std::memory_order_release);
+    
+    // Overflow events were added after the ring events, wait for
+    // producers still writing reserved slots
+    if (b_Overflow.load(std::memory_order_acquire) == true && us_Tail.load(std::memory_order_acquire) == us_Pos)
+    {
+        c_OverflowMutex.lock();
+        std::move(v_Overflow.begin(), v_Overflow.end(), std::back_inserter(v_Event));
+        v_Overflow.clear();
+        us_OverflowSize.store(0, std::memory_order_relaxed);
+        b_Overflow.store(false, std::memory_order_release);
+        c_OverflowMutex.unlock();
+    }
+    
+    return v_Event.size() - us_Start;
+}
+
+//*************************************************************************************
+// Statistics
+//*************************************************************************************
+
+void PoolRing::UpdateStatistics() noexcept
+{
+    size_t us_Depth = GetDepth();
+    size_t us_Max = us_MaxDepth.load(std::memory_order_relaxed);
+    
+    while (us_Max < us_Depth && us_MaxDepth.compare_exchange_weak(us_Max, us_Depth, std::memory_order_relaxed) == false)
+    {}
+}
+
+void PoolRing::LogStatistics(std::string const& s_Name) const noexcept
+{
+    Logger::Singleton().Log(Logger::INFO, "Ring " +
+                                          s_Name +
+                                          ": Depth " +
+                                          std::to_string(GetDepth()) +
+                                          " (max " +
+                                          std::to_string(GetMaxDepth()) +
+                                          " of " +
+                                          std::to_string(us_Size) +
+                                          "), Overflow events " +
+                                          std::to_string(GetOverflowEvents()) +
+                                          ", Contention " +
+                                          std::to_string(GetContention()),
+                            "PoolRing.cpp", __LINE__);
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+size_t PoolRing::GetDepth() const noexcept
+{
+    // Head first, the tail is never behind it
+    size_t us_Pos = us_Head.load(std::memory_order_acquire);
+    
+    return (us_Tail.load(std::memory_order_acquire) - us_Pos) + us_OverflowSize.load(std::memory_order_relaxed);
+}
+
+size_t PoolRing::GetMaxDepth() const noexcept
+{
+    return us_MaxDepth.load(std::memory_order_relaxed);
+}
+
+MRH_Uint64 PoolRing::GetOverflowEvents() const noexcept
+{
+    return u64_OverflowEvents;
+}
+
+MRH_Uint64 PoolRing::GetContention() const noexcept
+{
+    return u64_Contention;
+}
@@ -0,0 +1,223 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+ 
+#ifndef PoolRing_h
+#define PoolRing_h
+
+// C / C++
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <string>
+
+// External
+
+// Project
+#include "../../Event/Event.h"
+
+
+class PoolRing
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param us_Size The ring size, rounded up to a power of two.
+     *  \param b_MultiProducer If more than one thread adds events.
+     */
+    
+    PoolRing(size_t us_Size, bool b_MultiProducer);
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_PoolRing PoolRing class source.
+     */
+    
+    PoolRing(PoolRing const& c_PoolRing) = delete;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~PoolRing() noexcept;
+    
+    //*************************************************************************************
+    // Producer
+    //*************************************************************************************
+    
+    /**
+     *  Add events to the ring. Events which do not fit are kept in a overflow
+     *  list until the consumer takes them. This function is thread safe for
+     *  multi producer rings.
+     *
+     *  \param v_Event The events to add. The events will be moved an the vector cleared.
+     */
+    
+    void Push(std::vector<Event>& v_Event) noexcept;
+    
+    /**
+     *  Add a copy of a event to the ring. This function is thread safe for
+     *  multi producer rings.
+     *
+     *  \param c_Event The event to add.
+     */
+    
+    void Push(Event const& c_Event) noexcept;
+    
+    //*************************************************************************************
+    // Consumer
+    //*************************************************************************************
+    
+    /**
+     *  Take all available events from the ring. This function may only be
+     *  called by the consumer thread.
+     *
+     *  \param v_Event The vector to append the events to.
+     *
+     *  \return The amount of events taken.
+     */
+    
+    size_t Take(std::vector<Event>& v_Event) noexcept;
+    
+    //*************************************************************************************
+    // Statistics
+    //*************************************************************************************
+    
+    /**
+     *  Log the ring statistics. This function is thread safe.
+     *
+     *  \param s_Name The ring name used for logging.
+     */
+    
+    void LogStatistics(std::string const& s_Name) const noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of events waiting in the ring. This function is thread safe.
+     *
+     *  \return The ring depth.
+     */
+    
+    size_t GetDepth() const noexcept;
+    
+    /**
+     *  Get the largest ring depth seen. This function is thread safe.
+     *
+     *  \return The max ring depth.
+     */
+    
+    size_t GetMaxDepth() const noexcept;
+    
+    /**
+     *  Get the amount of events which did not fit into the ring. This function
+     *  is thread safe.
+     *
+     *  \return The overflow event count.
+     */
+    
+    MRH_Uint64 GetOverflowEvents() const noexcept;
+    
+    /**
+     *  Get the amount of failed producer reservations caused by other
+     *  producers. This function is thread safe.
+     *
+     *  \return The contention count.
+     */
+    
+    MRH_Uint64 GetContention() const noexcept;
+
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Slot
+    {
+        Slot() noexcept : us_Sequence(0),
+                          c_Event(0, MRH_EVENT_UNK)
+        {}
+        
+        // Ring position + 1 once the event is readable
+        std::atomic<size_t> us_Sequence;
+        Event c_Event;
+    };
+    
+    //*************************************************************************************
+    // Producer
+    //*************************************************************************************
+    
+    /**
+     *  Reserve ring slots for adding events.
+     *
+     *  \param us_Count The amount of slots wanted.
+     *  \param us_Pos The first reserved ring position.
+     *
+     *  \return The amount of slots reserved.
+     */
+    
+    size_t Reserve(size_t us_Count, size_t& us_Pos) noexcept;
+    
+    /**
+     *  Update the statistics after events were added.
+     */
+    
+    void UpdateStatistics() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::unique_ptr<Slot[]> p_Slot;
+    size_t us_Size;
+    size_t us_Mask;
+    bool b_MultiProducer;
+    
+    // Producer and consumer positions, kept on their own cache lines
+    std::atomic<size_t> us_Tail;
+    MRH_Uint8 p_TailPadding[64 - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> us_Head;
+    MRH_Uint8 p_HeadPadding[64 - sizeof(std::atomic<size_t>)];
+    
+    // Events waiting for free slots
+    // @NOTE: Producers keep adding to the overflow until the consumer took
+    //        it, this keeps the event order for each producer
+    std::mutex c_OverflowMutex;
+    std::vector<Event> v_Overflow;
+    std::atomic<bool> b_Overflow;
+    std::atomic<size_t> us_OverflowSize;
+    
+    // Statistics
+    std::atomic<size_t> us_MaxDepth;
+    std::atomic<MRH_Uint64> u64_OverflowEvents;
+    std::atomic<MRH_Uint64> u64_Contention;
+
+protected:
+
+};
+
+#endif /* PoolRing_h */
@@ -20,6 +20,7 @@
 
 // Project
 #include "./PoolService.h"
+#include "../../Logger/Logger.h"
 #include "../../Timer.h"
 
 
@@ -29,15 +30,38 @@
 
 PoolService::PoolService(std::shared_ptr<ServiceProcess>& p_Process,
                          std::shared_ptr<PoolCondition>& p_Condition,
+                         std::shared_ptr<PoolThrottle>& p_Throttle,
                          MRH_Uint32 u32_EventLimit,
                          MRH_Sint32 s32_TimeoutMS,
-                         bool b_Essential) : p_Process(p_Process),
+                         bool b_Essential) : PoolEvents(false, false), // Only the pool adds events to send
+                                             p_Process(p_Process),
+                                             p_ReactorEntry(NULL),
                                              p_Condition(p_Condition),
+                                             p_Throttle(p_Throttle),
+                                             u32_EventLimit(u32_EventLimit),
+                                             s32_TimeoutMS(s32_TimeoutMS),
                                              b_Essential(b_Essential)
 {
+    // Prefer the shared reactor, use a own thread otherwise
+    PoolReactor& c_PoolReactor = PoolReactor::Singleton();
+    
+    if (c_PoolReactor.GetEnabled() == true)
+    {
+        try
+        {
+            p_ReactorEntry = c_PoolReactor.Add(this);
+            return;
+        }
+        catch (ProcessException& e)
+        {
+            Logger::Singleton().Log(Logger::WARNING, e.what2() + " Using service thread.",
+                                    "PoolService.cpp", __LINE__);
+        }
+    }
+    
     try
     {
-        c_Thread = std::thread(Update, this, u32_EventLimit, s32_TimeoutMS);
+        c_Thread = std::thread(Update, this);
     }
     catch (std::exception& e)
     {
@@ -69,8 +93,12 @@ PoolService::~PoolService() noexcept
         }
     }
     
-    // Process stopped, join thread
-    if (c_Thread.joinable() == true)
+    // Process stopped, remove from reactor or join thread
+    if (p_ReactorEntry != NULL)
+    {
+        PoolReactor::Singleton().Remove(p_ReactorEntry);
+    }
+    else if (c_Thread.joinable() == true)
     {
         c_Thread.join();
     }
@@ -80,15 +108,14 @@ PoolService::~PoolService() noexcept
 // Update
 //*************************************************************************************
 
-void PoolService::Update(PoolService* p_Service, MRH_Uint32 u32_EventLimit, MRH_Sint32 s32_TimeoutMS) noexcept
+void PoolService::Update(PoolService* p_Service) noexcept
 {
     // Get values directly, a bit more readable
     // @NOTE: This function can only be called from a instance itself,
     //        so we're able to use raw pointers more safely
     std::shared_ptr<PoolCondition>& p_Condition = p_Service->p_Condition;
     std::shared_ptr<ServiceProcess>& p_Process = p_Service->p_Process;
-    std::vector<Event>* p_Queue = p_Service->p_Queue;
-    std::mutex* p_Mutex = p_Service->p_Mutex;
+    MRH_Sint32 s32_TimeoutMS = p_Service->s32_TimeoutMS;
     bool b_Recieve = p_Process->GetCanSend();
     bool b_Send = p_Process->GetCanRecieve();
     
@@ -97,37 +124,84 @@ void PoolService::Update(PoolService* p_Service, MRH_Uint32 u32_EventLimit, MRH_
     while (p_Process->GetRunning() == true)
     {
         // Read incoming events
-        if (b_Recieve == true)
+        if (b_Recieve == true && p_Service->GetRecieveThrottled() == false)
         {
-            // Recieve first
-            p_Process->RecieveEvents(u32_EventLimit, s32_TimeoutMS);
-            
-            // Add to recieved queue so that the pool can retrieve the events
-            p_Mutex[RECIEVED].lock();
-            std::vector<Event>& v_Event = p_Process->RetrieveEvents();
-            std::move(v_Event.begin(), v_Event.end(), std::back_inserter(p_Queue[RECIEVED]));
-            p_Mutex[RECIEVED].unlock();
+            size_t us_Recieved = p_Service->UpdateRecieve(s32_TimeoutMS);
             
-            // Signal condition, we have something to get for the service pool
-            p_Condition->Notify();
+            // Signal condition if we have something to get for the service pool
+            if (us_Recieved > 0)
+            {
+                p_Condition->Notify(static_cast<MRH_Uint32>(us_Recieved));
+            }
         }
         else if (s32_TimeoutMS > 0)
         {
             // Wait for timeout, we dont want to spin this loop unless
             // explicitly desired by timeout value
+            // @NOTE: Throttled services also wait here for new credit
             std::this_thread::sleep_for(std::chrono::milliseconds(s32_TimeoutMS));
         }
         
         // Send events
         if (b_Send == true)
         {
-            p_Mutex[SEND].lock();
-            p_Process->SendEvents(p_Queue[SEND], u32_EventLimit);
-            p_Mutex[SEND].unlock();
+            p_Service->UpdateSend();
         }
     }
 }
 
+size_t PoolService::UpdateRecieve(MRH_Sint32 s32_TimeoutMS) noexcept
+{
+    // Recieve first, limited by the consumer credit
+    MRH_Uint32 u32_Limit = p_Throttle->GetEventLimit(u32_EventLimit);
+    
+    if (u32_Limit == 0)
+    {
+        return 0;
+    }
+    
+    p_Process->RecieveEvents(u32_Limit, s32_TimeoutMS);
+    
+    // Add to recieved ring so that the pool can retrieve the events
+    std::vector<Event>& v_Event = p_Process->RetrieveEvents();
+    size_t us_Recieved = v_Event.size();
+#if MRH_CORE_EVENT_TRACING > 0
+    for (auto& Recieved : v_Event)
+    {
+        EventTrace::Singleton().Record(EventTrace::POOL, Recieved, 0);
+    }
+#endif
+    p_Ring[RECIEVED].Push(v_Event);
+    
+    return us_Recieved;
+}
+
+bool PoolService::GetRecieveThrottled() const noexcept
+{
+    return p_Throttle->GetEventLimit(u32_EventLimit) == 0;
+}
+
+bool PoolService::UpdateSend() noexcept
+{
+    p_Ring[SEND].Take(p_Queue[SEND]);
+    p_Process->SendEvents(p_Queue[SEND], u32_EventLimit);
+    
+    return p_Process->GetSendQueueDepth() > 0;
+}
+
+//*************************************************************************************
+// Send
+//*************************************************************************************
+
+void PoolService::NotifySend() noexcept
+{
+    // Service threads send on each update
+    if (p_ReactorEntry != NULL)
+    {
+        PoolReactor::Singleton().Notify(p_ReactorEntry);
+    }
+}
+
 //*************************************************************************************
 // Getters
 //*************************************************************************************
@@ -141,3 +215,8 @@ bool PoolService::GetEssential() const noexcept
 {
     return b_Essential;
 }
+
+size_t PoolService::GetSendBacklog() noexcept
+{
+    return p_Ring[SEND].GetDepth() + p_Process->GetSendQueueDepth();
+}
@@ -28,11 +28,15 @@
 // Project
 #include "../ServiceProcess.h"
 #include "./PoolCondition.h"
+#include "./PoolThrottle.h"
 #include "./PoolEvents.h"
+#include "./PoolReactor.h"
 
 
 class PoolService : public PoolEvents
 {
+    friend class PoolReactor;
+    
 public:
     
     //*************************************************************************************
@@ -45,6 +49,17 @@ public:
     
     virtual ~PoolService() noexcept;
     
+    //*************************************************************************************
+    // Send
+    //*************************************************************************************
+    
+    /**
+     *  Notify the service update that events to send were added. This
+     *  function is thread safe.
+     */
+    
+    void NotifySend() noexcept;
+    
     //*************************************************************************************
     // Getters
     //*************************************************************************************
@@ -65,6 +80,15 @@ public:
     
     bool GetEssential() const noexcept;
     
+    /**
+     *  Get the amount of events waiting to be sent to the service. This function
+     *  is thread safe.
+     *
+     *  \return The send backlog.
+     */
+    
+    size_t GetSendBacklog() noexcept;
+    
     //*************************************************************************************
     // Data
     //*************************************************************************************
@@ -78,21 +102,49 @@ private:
     //*************************************************************************************
     
     /**
-     *  Update the service.
+     *  Update the service on its own thread.
      *
      *  \param p_Service The service instance to update with.
-     *  \param u32_EventLimit The max amount of event to be sent / recieved in a update.  
+     */
+    
+    static void Update(PoolService* p_Service) noexcept;
+    
+    /**
+     *  Recieve service events and add them to the recieved queue.
+     *
      *  \param s32_TimeoutMS The event recieve timeout in milliseconds.
+     *
+     *  \return The amount of recieved events.
+     */
+    
+    size_t UpdateRecieve(MRH_Sint32 s32_TimeoutMS) noexcept;
+    
+    /**
+     *  Check if recieving is throttled by the service pool consumers.
+     *
+     *  \return true if no events should be recieved, false if not.
+     */
+    
+    bool GetRecieveThrottled() const noexcept;
+    
+    /**
+     *  Send the events in the send queue to the service.
+     *
+     *  \return true if events are left to send, false if not.
      */
     
-    static void Update(PoolService* p_Service, MRH_Uint32 u32_EventLimit, MRH_Sint32 s32_TimeoutMS) noexcept;
+    bool UpdateSend() noexcept;
     
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
     std::thread c_Thread;
+    PoolReactor::Entry* p_ReactorEntry;
     std::shared_ptr<PoolCondition> p_Condition;
+    std::shared_ptr<PoolThrottle> p_Throttle;
+    MRH_Uint32 u32_EventLimit;
+    MRH_Sint32 s32_TimeoutMS;
     bool b_Essential;
     
 protected:
@@ -106,6 +158,7 @@ protected:
      *
      *  \param p_Process The process for this service.
      *  \param p_Condition The service pool condition for notification.
+     *  \param p_Throttle The service pool throttle limiting recieved events.
      *  \param u32_EventLimit The max amount of event to be sent / recieved in a update.
      *  \param s32_TimeoutMS The event recieve timeout in milliseconds.
      *  \param b_Essential Wether the service is essential or not.
@@ -113,6 +166,7 @@ protected:
     
     PoolService(std::shared_ptr<ServiceProcess>& p_Process,
                 std::shared_ptr<PoolCondition>& p_Condition,
+                std::shared_ptr<PoolThrottle>& p_Throttle,
                 MRH_Uint32 u32_EventLimit,
                 MRH_Sint32 s32_TimeoutMS,
                 bool b_Essential);
@@ -0,0 +1,197 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+#include <chrono>
+#include <limits>
+
+// External
+
+// Project
+#include "./PoolThrottle.h"
+#include "../../Logger/Logger.h"
+
+// Pre-defined
+namespace
+{
+    MRH_Uint64 GetTimeMS() noexcept
+    {
+        return static_cast<MRH_Uint64>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+PoolThrottle::PoolThrottle(std::string const& s_Name,
+                           size_t us_HighWatermark,
+                           size_t us_LowWatermark) noexcept : s_Name(s_Name),
+                                                              us_HighWatermark(us_HighWatermark),
+                                                              us_LowWatermark(us_LowWatermark),
+                                                              us_Backlog(0),
+                                                              b_Throttled(false),
+                                                              u64_StallStartMS(0),
+                                                              u64_StalledMS(0),
+                                                              u64_ThrottledEvents(0),
+                                                              us_ProducerCredit(std::numeric_limits<size_t>::max())
+{}
+
+PoolThrottle::~PoolThrottle() noexcept
+{}
+
+//*************************************************************************************
+// Consumer
+//*************************************************************************************
+
+bool PoolThrottle::Update(size_t us_Backlog) noexcept
+{
+    if (us_HighWatermark == 0)
+    {
+        return false;
+    }
+    
+    size_t us_Previous = this->us_Backlog.exchange(us_Backlog);
+    
+    if (b_Throttled == true)
+    {
+        // Producers still added events which were already read
+        if (us_Backlog > us_Previous)
+        {
+            u64_ThrottledEvents += us_Backlog - us_Previous;
+        }
+        
+        if (us_Backlog > us_LowWatermark)
+        {
+            return false;
+        }
+        
+        MRH_Uint64 u64_StallMS = GetTimeMS() - u64_StallStartMS;
+        u64_StalledMS += u64_StallMS;
+        b_Throttled = false;
+        
+        Logger::Singleton().Log(Logger::INFO, "Released " +
+                                              s_Name +
+                                              " producers after " +
+                                              std::to_string(u64_StallMS) +
+                                              " ms.",
+                                "PoolThrottle.cpp", __LINE__);
+        return true;
+    }
+    else if (us_Backlog >= us_HighWatermark)
+    {
+        u64_StallStartMS = GetTimeMS();
+        b_Throttled = true;
+        
+        Logger::Singleton().Log(Logger::WARNING, "Throttling " +
+                                                 s_Name +
+                                                 " producers, send backlog is " +
+                                                 std::to_string(us_Backlog) +
+                                                 " events!",
+                                "PoolThrottle.cpp", __LINE__);
+        return true;
+    }
+    
+    return false;
+}
+
+void PoolThrottle::LogStatistics() const noexcept
+{
+    if (us_HighWatermark == 0)
+    {
+        return;
+    }
+    
+    Logger::Singleton().Log(Logger::INFO, "Throttle " +
+                                          s_Name +
+                                          ": Backlog " +
+                                          std::to_string(us_Backlog) +
+                                          " (" +
+                                          std::to_string(us_LowWatermark) +
+                                          " - " +
+                                          std::to_string(us_HighWatermark) +
+                                          "), Throttled " +
+                                          (b_Throttled == true ? "yes" : "no") +
+                                          ", Stalled " +
+                                          std::to_string(GetStalledMS()) +
+                                          " ms, Throttled events " +
+                                          std::to_string(u64_ThrottledEvents),
+                            "PoolThrottle.cpp", __LINE__);
+}
+
+//*************************************************************************************
+// Producer
+//*************************************************************************************
+
+void PoolThrottle::SetProducerCredit(size_t us_Credit) noexcept
+{
+    us_ProducerCredit = us_Credit;
+}
+
+MRH_Uint32 PoolThrottle::GetEventLimit(MRH_Uint32 u32_EventLimit) const noexcept
+{
+    size_t us_Credit = us_ProducerCredit;
+    
+    if (us_Credit < u32_EventLimit)
+    {
+        return static_cast<MRH_Uint32>(us_Credit);
+    }
+    
+    return u32_EventLimit;
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+size_t PoolThrottle::GetCredit() const noexcept
+{
+    if (us_HighWatermark == 0)
+    {
+        return std::numeric_limits<size_t>::max();
+    }
+    else if (b_Throttled == true)
+    {
+        return 0;
+    }
+    
+    size_t us_Backlog = this->us_Backlog;
+    
+    return (us_Backlog < us_HighWatermark ? us_HighWatermark - us_Backlog : 0);
+}
+
+bool PoolThrottle::GetThrottled() const noexcept
+{
+    return b_Throttled;
+}
+
+MRH_Uint64 PoolThrottle::GetStalledMS() const noexcept
+{
+    // Include the current stall
+    if (b_Throttled == true)
+    {
+        return u64_StalledMS + (GetTimeMS() - u64_StallStartMS);
+    }
+    
+    return u64_StalledMS;
+}
+
+MRH_Uint64 PoolThrottle::GetThrottledEvents() const noexcept
+{
+    return u64_ThrottledEvents;
+}
@@ -0,0 +1,172 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+ 
+ 
+#ifndef PoolThrottle_h
+#define PoolThrottle_h
+
+// C / C++
+#include <atomic>
+#include <string>
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+
+
+class PoolThrottle
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param s_Name The consumer name used for logging.
+     *  \param us_HighWatermark The send backlog at which producers are throttled, 0 to disable.
+     *  \param us_LowWatermark The send backlog at which throttled producers are released.
+     */
+    
+    PoolThrottle(std::string const& s_Name, size_t us_HighWatermark, size_t us_LowWatermark) noexcept;
+    
+    /**
+     *  Copy constructor. Disabled for this class.
+     *
+     *  \param c_PoolThrottle PoolThrottle class source.
+     */
+    
+    PoolThrottle(PoolThrottle const& c_PoolThrottle) = delete;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~PoolThrottle() noexcept;
+    
+    //*************************************************************************************
+    // Consumer
+    //*************************************************************************************
+    
+    /**
+     *  Update the consumer send backlog. Producers are throttled once the backlog
+     *  reaches the high watermark until it drops to the low watermark.
+     *
+     *  \param us_Backlog The largest amount of events waiting to be sent to a consumer.
+     *
+     *  \return true if the throttle state changed, false if not.
+     */
+    
+    bool Update(size_t us_Backlog) noexcept;
+    
+    /**
+     *  Log the throttle statistics.
+     */
+    
+    void LogStatistics() const noexcept;
+    
+    //*************************************************************************************
+    // Producer
+    //*************************************************************************************
+    
+    /**
+     *  Set the amount of events producers are allowed to read per batch. This
+     *  function is thread safe.
+     *
+     *  \param us_Credit The producer credit.
+     */
+    
+    void SetProducerCredit(size_t us_Credit) noexcept;
+    
+    /**
+     *  Get the event limit for a producer batch. This function is thread safe.
+     *
+     *  \param u32_EventLimit The configured event limit.
+     *
+     *  \return The event limit, 0 if the producer is throttled.
+     */
+    
+    MRH_Uint32 GetEventLimit(MRH_Uint32 u32_EventLimit) const noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of events producers may add for the consumers. This
+     *  function is thread safe.
+     *
+     *  \return The consumer credit.
+     */
+    
+    size_t GetCredit() const noexcept;
+    
+    /**
+     *  Check if producers for the consumers are throttled. This function is
+     *  thread safe.
+     *
+     *  \return true if throttled, false if not.
+     */
+    
+    bool GetThrottled() const noexcept;
+    
+    /**
+     *  Get the total time producers were throttled. This function is thread safe.
+     *
+     *  \return The stalled time in milliseconds.
+     */
+    
+    MRH_Uint64 GetStalledMS() const noexcept;
+    
+    /**
+     *  Get the amount of events added for consumers while throttled. This
+     *  function is thread safe.
+     *
+     *  \return The throttled event count.
+     */
+    
+    MRH_Uint64 GetThrottledEvents() const noexcept;
+
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::string s_Name;
+    
+    // Consumer
+    size_t us_HighWatermark;
+    size_t us_LowWatermark;
+    std::atomic<size_t> us_Backlog;
+    std::atomic<bool> b_Throttled;
+    
+    // Statistics
+    std::atomic<MRH_Uint64> u64_StallStartMS;
+    std::atomic<MRH_Uint64> u64_StalledMS;
+    std::atomic<MRH_Uint64> u64_ThrottledEvents;
+    
+    // Producer
+    std::atomic<size_t> us_ProducerCredit;
+
+protected:
+
+};
+
+#endif /* PoolThrottle_h */
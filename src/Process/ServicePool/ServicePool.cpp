@@ -31,12 +31,25 @@
 // Constructor / Destructor
 //*************************************************************************************
 
-ServicePool::ServicePool() : b_Run(false)
+ServicePool::ServicePool(std::string const& s_Name, CoreConfiguration::Queue e_Queue) : PoolEvents(true, true), // Send events are added by the core threads
+                                                                                        s_Name(s_Name),
+                                                                                        b_Run(false),
+                                                                                        b_LogStatistics(false)
 {
+    CoreConfiguration& c_CoreConfiguration = CoreConfiguration::Singleton();
+    
     // Thread stuff
     try
     {
         p_Condition = std::make_shared<PoolCondition>();
+        p_RecievedCondition = std::make_shared<PoolCondition>();
+        p_Throttle = std::make_shared<PoolThrottle>(s_Name,
+                                                    c_CoreConfiguration.GetSendHighWatermark(e_Queue),
+                                                    c_CoreConfiguration.GetSendLowWatermark(e_Queue));
+    }
+    catch (ProcessException& e)
+    {
+        throw;
     }
     catch (std::exception& e)
     {
@@ -95,15 +108,28 @@ void ServicePool::Update(ServicePool* p_ServicePool, MRH_Sint32 s32_TimeoutMS) n
     // Constantly update
     while (p_ServicePool->b_Run == true)
     {
-        // Wait for services to notify us
-        p_Condition->Wait(s32_TimeoutMS);
+        // Wait for services or new send events to notify us
+        MRH_Uint64 u64_Pending = p_Condition->Wait(s32_TimeoutMS);
         
         // Check service health
         p_ServicePool->CheckServiceStatus();
         
         // Call virtual to exchange service events defined by the inheriting class
-        p_ServicePool->RetrieveRecievedEvents();
-        p_ServicePool->DistributeSendEvents();
+        // @NOTE: Nothing changed if nothing is pending, no need to scan the services
+        if (u64_Pending > 0)
+        {
+            p_ServicePool->RetrieveRecievedEvents();
+            p_ServicePool->DistributeSendEvents();
+        }
+        
+        // Check consumer backlog, services might have sent without notification
+        p_ServicePool->UpdateThrottle();
+        
+        // Services are only touched here, log requested statistics now
+        if (p_ServicePool->b_LogStatistics.exchange(false) == true)
+        {
+            p_ServicePool->LogServiceStatistics();
+        }
     }
 }
 
@@ -133,6 +159,7 @@ void ServicePool::CheckServiceStatus() noexcept
             }
             
             // Remove stopped, dead weight
+            RemoveService(Service->get());
             Service = v_Service.erase(Service);
         }
         else
@@ -175,12 +202,46 @@ void ServicePool::WritePidList(std::string s_ListName, std::vector<pid_t> const&
                             "ServicePool.cpp", __LINE__);
 }
 
+void ServicePool::RemoveService(PoolService*) noexcept
+{}
+
+void ServicePool::UpdateThrottle() noexcept
+{
+    size_t us_Backlog = 0;
+    
+    for (auto& Service : v_Service)
+    {
+        size_t us_ServiceBacklog = Service->GetSendBacklog();
+        
+        if (us_ServiceBacklog > us_Backlog)
+        {
+            us_Backlog = us_ServiceBacklog;
+        }
+    }
+    
+    // Wake the pool user to pass the changed credit to producers
+    if (p_Throttle->Update(us_Backlog) == true)
+    {
+        p_RecievedCondition->Notify(0);
+    }
+}
+
+void ServicePool::LogServiceStatistics() noexcept
+{
+    for (auto& Service : v_Service)
+    {
+        Service->GetProcess()->LogStatistics();
+    }
+}
+
 //*************************************************************************************
 // Recieve
 //*************************************************************************************
 
 void ServicePool::RetrieveRecievedEvents() noexcept
 {
+    size_t us_Recieved = 0;
+    
     for (auto& Service : v_Service)
     {
         std::shared_ptr<ServiceProcess> const& p_Process = Service->GetProcess();
@@ -190,20 +251,16 @@ void ServicePool::RetrieveRecievedEvents() noexcept
             continue;
         }
         
-        // Lock Mutexes
-        p_Mutex[RECIEVED].lock();
-        Service->LockRecievedEvents();
-        
-        // Event movement
-        std::vector<Event>& v_Event = Service->RetrieveEvents();
-        std::move(v_Event.begin(), v_Event.end(), std::back_inserter(p_Queue[RECIEVED]));
-        
-        // Unlock pool mutex, now available
-        p_Mutex[RECIEVED].unlock();
-        
-        // Clear and unlock service
-        v_Event.clear();
-        Service->UnlockRecievedEvents();
+        // Collect from all services, published at once
+        us_Recieved += Service->RetrieveEvents(p_Queue[RECIEVED]);
+    }
+    
+    PublishRecievedEvents(p_Queue[RECIEVED]);
+    
+    // Signal the pool user, we have something to get
+    if (us_Recieved > 0)
+    {
+        p_RecievedCondition->Notify(static_cast<MRH_Uint32>(us_Recieved));
     }
 }
 
@@ -211,13 +268,26 @@ void ServicePool::RetrieveRecievedEvents() noexcept
 // Send
 //*************************************************************************************
 
+void ServicePool::SendEvents(std::vector<Event>& v_Event) noexcept
+{
+    size_t us_Count = v_Event.size();
+    
+    if (us_Count == 0)
+    {
+        return;
+    }
+    
+    PoolEvents::SendEvents(v_Event);
+    p_Condition->Notify(static_cast<MRH_Uint32>(us_Count));
+}
+
 void ServicePool::DistributeSendEvents() noexcept
 {
-    // Lock send queue
-    // @NOTE: We lock for the whole distribution duration so that
-    //        all current events are sent to all services, unlocking
-    //        after each service might cause us to miss events
-    p_Mutex[SEND].lock();
+    // Take all current events, each service gets a copy
+    if (p_Ring[SEND].Take(p_Queue[SEND]) == 0)
+    {
+        return;
+    }
     
     for (auto& Service : v_Service)
     {
@@ -225,13 +295,26 @@ void ServicePool::DistributeSendEvents() noexcept
         
         if (p_Process->GetRunning() == true && p_Process->GetCanRecieve() == true)
         {
-            Service->SendEvents(p_Queue[SEND]);
+            std::vector<Event> v_Event(p_Queue[SEND]);
+            Service->SendEvents(v_Event);
+            Service->NotifySend();
         }
     }
     
     // All sent, clear original
     p_Queue[SEND].clear();
-    p_Mutex[SEND].unlock();
+}
+
+//*************************************************************************************
+// Statistics
+//*************************************************************************************
+
+void ServicePool::LogStatistics() noexcept
+{
+    PoolEvents::LogStatistics(s_Name);
+    
+    b_LogStatistics = true;
+    p_Condition->Notify(0);
 }
 
 //*************************************************************************************
@@ -242,3 +325,13 @@ bool ServicePool::GetRunning() const noexcept
 {
     return b_Run;
 }
+
+PoolCondition& ServicePool::GetRecievedCondition() noexcept
+{
+    return *p_RecievedCondition;
+}
+
+PoolThrottle& ServicePool::GetThrottle() noexcept
+{
+    return *p_Throttle;
+}
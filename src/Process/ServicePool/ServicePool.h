@@ -25,6 +25,7 @@
 
 // Project
 #include "./PoolService.h"
+#include "../../Configuration/CoreConfiguration.h"
 
 
 class ServicePool : public PoolEvents
@@ -43,6 +44,50 @@ public:
     
     bool GetRunning() const noexcept;
     
+    /**
+     *  Get the recieved event notification. The notification is signaled
+     *  once recieved events can be retrieved. This function is thread safe.
+     *
+     *  \return The recieved event notification.
+     */
+    
+    PoolCondition& GetRecievedCondition() noexcept;
+    
+    /**
+     *  Get the service pool throttle. The throttle tracks the pool services
+     *  as consumers and limits the events recieved from them as producers.
+     *  This function is thread safe.
+     *
+     *  \return The service pool throttle.
+     */
+    
+    PoolThrottle& GetThrottle() noexcept;
+    
+    //*************************************************************************************
+    // Send
+    //*************************************************************************************
+    
+    /**
+     *  Add events to send to the services and notify the service pool. This
+     *  function is thread safe.
+     *
+     *  \param v_Event The events to send. The events will be moved an the vector cleared.
+     */
+    
+    void SendEvents(std::vector<Event>& v_Event) noexcept override;
+    
+    //*************************************************************************************
+    // Statistics
+    //*************************************************************************************
+    
+    /**
+     *  Log the service pool event queue statistics. The service queues are
+     *  logged by the service pool thread on the next update. This function
+     *  is thread safe.
+     */
+    
+    void LogStatistics() noexcept;
+
 private:
 
     //*************************************************************************************
@@ -53,7 +98,8 @@ private:
      *  Update the service pool. This function is thread safe.
      *
      *  \param p_ServicePool The service pool instance to update with.
-     *  \param s32_TimeoutMS The condition timeout in milliseconds.
+     *  \param s32_TimeoutMS The condition timeout in milliseconds. Service status is
+     *                       checked at least once per timeout.
      */
     
     static void Update(ServicePool* p_ServicePool, MRH_Sint32 s32_TimeoutMS) noexcept;
@@ -64,14 +110,31 @@ private:
     
     void CheckServiceStatus() noexcept;
     
+    /**
+     *  Update the service pool throttle with the largest service send backlog.
+     */
+    
+    void UpdateThrottle() noexcept;
+    
+    /**
+     *  Log the event queue statistics of the pool services.
+     */
+    
+    void LogServiceStatistics() noexcept;
+    
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
+    std::string s_Name;
+    
     // Threaded update info
     std::thread c_Thread;
     std::atomic<bool> b_Run;
     
+    // Service statistics requested for the next update
+    std::atomic<bool> b_LogStatistics;
+    
 protected:
     
     //*************************************************************************************
@@ -80,9 +143,12 @@ protected:
     
     /**
      *  Default constructor.
+     *
+     *  \param s_Name The service pool name used for logging.
+     *  \param e_Queue The configuration queue used by the pool services.
      */
     
-    ServicePool();
+    ServicePool(std::string const& s_Name, CoreConfiguration::Queue e_Queue);
     
     /**
      *  Copy constructor. Disabled for this class.
@@ -125,6 +191,14 @@ protected:
     
     void WritePidList(std::string s_ListName, std::vector<pid_t> const& v_Pid) noexcept;
     
+    /**
+     *  Remove a stopped service before it is erased from the service list.
+     *
+     *  \param p_Service The stopped service.
+     */
+    
+    virtual void RemoveService(PoolService* p_Service) noexcept;
+    
     //*************************************************************************************
     // Recieve
     //*************************************************************************************
@@ -154,6 +228,10 @@ protected:
     
     // Threaded update info
     std::shared_ptr<PoolCondition> p_Condition;
+    std::shared_ptr<PoolCondition> p_RecievedCondition;
+    
+    // Backpressure
+    std::shared_ptr<PoolThrottle> p_Throttle;
 };
 
 #endif /* ServicePool_h */
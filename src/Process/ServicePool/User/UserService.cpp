@@ -28,9 +28,11 @@
 
 UserService::UserService(std::shared_ptr<ServiceProcess>& p_Process,
                          std::shared_ptr<PoolCondition>& p_Condition,
+                         std::shared_ptr<PoolThrottle>& p_Throttle,
                          MRH_Uint32 u32_EventLimit,
                          MRH_Sint32 s32_TimeoutMS) : PoolService(p_Process,
                                                                  p_Condition,
+                                                                 p_Throttle,
                                                                  u32_EventLimit,
                                                                  s32_TimeoutMS,
                                                                  false) // User services are not essential
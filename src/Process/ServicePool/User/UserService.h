@@ -52,12 +52,14 @@ private:
      *
      *  \param p_Process The process for this service.
      *  \param p_Condition The service pool condition for notification.
+     *  \param p_Throttle The service pool throttle limiting recieved events.
      *  \param u32_EventLimit The max amount of event to be sent / recieved in a update.
      *  \param s32_TimeoutMS The event recieve timeout in milliseconds.
      */
     
     UserService(std::shared_ptr<ServiceProcess>& p_Process,
                 std::shared_ptr<PoolCondition>& p_Condition,
+                std::shared_ptr<PoolThrottle>& p_Throttle,
                 MRH_Uint32 u32_EventLimit,
                 MRH_Sint32 s32_TimeoutMS);
                 
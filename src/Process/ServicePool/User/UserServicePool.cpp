@@ -24,6 +24,7 @@
 #include "../../User/UserServiceProcess.h"
 #include "../../../Configuration/UserServiceList.h"
 #include "../../../Configuration/CoreConfiguration.h"
+#include "../../../Event/EventTrace.h"
 #include "../../../Package/PackageContainer.h"
 #include "../../../FilePaths.h"
 #include "../../../Logger/Logger.h"
@@ -33,7 +34,8 @@
 // Constructor / Destructor
 //*************************************************************************************
 
-UserServicePool::UserServicePool()
+UserServicePool::UserServicePool(ServicePool* p_ForwardPool) : ServicePool("user service", CoreConfiguration::USER_SERVICE),
+                                                               p_ForwardPool(p_ForwardPool)
 {
     try
     {
@@ -42,7 +44,7 @@ UserServicePool::UserServicePool()
         size_t us_PackageCount = c_ServiceList.GetPackageCount();
         std::vector<pid_t> v_Pid;
         
-        if (PackageContainer::Singleton().GetPackageCount() == 0 || us_PackageCount == 0)
+        if (PackageContainer::Singleton().GetCatalog()->GetPackageCount() == 0 || us_PackageCount == 0)
         {
             // No user services, maybe none installed or none enabled
             Logger::Singleton().Log(Logger::INFO, "No user service packages.", "UserServiceProcess.cpp", __LINE__);
@@ -81,10 +83,13 @@ UserServicePool::UserServicePool()
 
 UserServicePool::~UserServicePool() noexcept
 {
+    // Stop forwarding before this instance is destroyed
+    StopUpdate();
+    
     // Clear pid list
     WritePidList(MRH_CORE_PLATFORM_SERVICE_PID_FILE, {});
     
-    // Stop and clear handled by base destructor
+    // Clear handled by base destructor
 }
 
 //*************************************************************************************
@@ -98,18 +103,30 @@ pid_t UserServicePool::AddService(std::string const& s_PackageName)
     
     try
     {
-        Package const& s_Package = PackageContainer::Singleton().GetPackage(s_PackageName);
+        std::shared_ptr<const PackageContainer::Catalog> p_Catalog = PackageContainer::Singleton().GetCatalog();
+        Package const& s_Package = p_Catalog->GetPackage(s_PackageName);
         
         // We rather cast the shared_ptr to have a guarantee that this instance
         // deallocates on exception by going out of scope. This will also
         // terminate the running process.
-        std::shared_ptr<ServiceProcess> p_Process(new UserServiceProcess());
+        std::shared_ptr<ServiceProcess> p_Process(new UserServiceProcess(c_CoreConfiguration.GetEventSource(CoreConfiguration::USER_SERVICE)));
+        p_Process->SetTransport(c_CoreConfiguration.GetPipeSize(CoreConfiguration::USER_SERVICE),
+                                c_CoreConfiguration.GetReadBatchSize(CoreConfiguration::USER_SERVICE),
+                                c_CoreConfiguration.GetWriteBatchSize(CoreConfiguration::USER_SERVICE));
+        p_Process->SetWireVersion(c_CoreConfiguration.GetWireVersion(CoreConfiguration::USER_SERVICE));
         std::dynamic_pointer_cast<UserServiceProcess>(p_Process)->Run(s_Package,
                                                                       c_CoreConfiguration.GetAppServiceParentBinaryPath(),
                                                                       u32_EventLimit);
+        
+        Logger::Singleton().Log(Logger::INFO, "User service " +
+                                              s_PackageName +
+                                              " transport: " +
+                                              p_Process->GetTransportInfo(),
+                                "UserServicePool.cpp", __LINE__);
 
         v_Service.emplace_back(std::shared_ptr<UserService>(new UserService(p_Process,
                                                                             p_Condition,
+                                                                            p_Throttle,
                                                                             u32_EventLimit,
                                                                             c_CoreConfiguration.GetRecieveTimeoutMS(CoreConfiguration::USER_SERVICE))));
         
@@ -216,6 +233,41 @@ void UserServicePool::Reload()
     StartUpdate(CoreConfiguration::Singleton().GetRecieveTimeoutMS(CoreConfiguration::USER_SERVICE));
 }
 
+//*************************************************************************************
+// Recieve
+//*************************************************************************************
+
+void UserServicePool::RetrieveRecievedEvents() noexcept
+{
+    for (auto& Service : v_Service)
+    {
+        std::shared_ptr<ServiceProcess> const& p_Process = Service->GetProcess();
+        
+        if (p_Process->GetRunning() == false || p_Process->GetCanSend() == false)
+        {
+            continue;
+        }
+        
+        Service->RetrieveEvents(p_Queue[RECIEVED]);
+    }
+    
+    if (p_Queue[RECIEVED].size() == 0)
+    {
+        return;
+    }
+    
+#if MRH_CORE_EVENT_TRACING > 0
+    for (auto& Recieved : p_Queue[RECIEVED])
+    {
+        EventTrace::Singleton().Record(EventTrace::CORE, Recieved, 0);
+    }
+#endif
+    
+    // Events were filtered by the user service process, no need
+    // to pass them through the core
+    p_ForwardPool->SendEvents(p_Queue[RECIEVED]);
+}
+
 //*************************************************************************************
 // Send
 //*************************************************************************************
@@ -35,9 +35,11 @@ public:
     
     /**
      *  Default constructor.
+     *
+     *  \param p_ForwardPool The service pool recieving all user service events.
      */
     
-    UserServicePool();
+    UserServicePool(ServicePool* p_ForwardPool);
     
     /**
      *  Copy constructor. Disabled for this class.
@@ -77,6 +79,16 @@ private:
     
     pid_t AddService(std::string const& s_PackageName);
     
+    //*************************************************************************************
+    // Recieve
+    //*************************************************************************************
+    
+    /**
+     *  Forward all recieved user service events to the forward pool.
+     */
+    
+    void RetrieveRecievedEvents() noexcept override;
+    
     //*************************************************************************************
     // Send
     //*************************************************************************************
@@ -91,6 +103,8 @@ private:
     // Data
     //*************************************************************************************
     
+    ServicePool* p_ForwardPool;
+
 protected:
     
 };
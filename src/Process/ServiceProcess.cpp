@@ -39,6 +39,20 @@ ServiceProcess::~ServiceProcess() noexcept
     // @NOTE: Process class terminates process on destruction!
 }
 
+//*************************************************************************************
+// Transport
+//*************************************************************************************
+
+void ServiceProcess::SetTransport(size_t us_PipeSize, size_t us_ReadBatchSize, MRH_Uint32 u32_WriteBatchSize) noexcept
+{
+    EventQueue::SetTransport(us_PipeSize, us_ReadBatchSize, u32_WriteBatchSize);
+}
+
+void ServiceProcess::SetWireVersion(MRH_Uint32 u32_WireVersion) noexcept
+{
+    EventQueue::SetWireVersion(u32_WireVersion);
+}
+
 //*************************************************************************************
 // Recieve
 //*************************************************************************************
@@ -46,6 +60,12 @@ ServiceProcess::~ServiceProcess() noexcept
 void ServiceProcess::RecieveEvents(MRH_Uint32 u32_EventLimit, MRH_Sint32 s32_TimeoutMS) noexcept
 {
     EventQueue::RecieveEvents(u32_EventLimit, s32_TimeoutMS);
+    
+    // A child which broke the transmission can't be trusted anymore
+    if (EventQueue::GetFailed() == true)
+    {
+        Stop(true);
+    }
 }
 
 std::vector<Event>& ServiceProcess::RetrieveEvents() noexcept
@@ -53,6 +73,11 @@ std::vector<Event>& ServiceProcess::RetrieveEvents() noexcept
     return EventQueue::RetrieveEvents();
 }
 
+bool ServiceProcess::PrepareRecievePoll() noexcept
+{
+    return EventQueue::PrepareRecievePoll();
+}
+
 //*************************************************************************************
 // Send
 //*************************************************************************************
@@ -65,12 +90,26 @@ void ServiceProcess::AddSendEvents(std::vector<Event>& v_Event) noexcept
 void ServiceProcess::SendEvents(MRH_Uint32 u32_EventLimit) noexcept
 {
     EventQueue::SendEvents(u32_EventLimit);
+    
+    if (EventQueue::GetFailed() == true)
+    {
+        Stop(true);
+    }
 }
 
 void ServiceProcess::SendEvents(std::vector<Event>& v_Event, MRH_Uint32 u32_EventLimit) noexcept
 {
     EventQueue::AddSendEvents(v_Event);
-    EventQueue::SendEvents(u32_EventLimit);
+    ServiceProcess::SendEvents(u32_EventLimit);
+}
+
+//*************************************************************************************
+// Statistics
+//*************************************************************************************
+
+void ServiceProcess::LogStatistics() noexcept
+{
+    EventQueue::LogStatistics(s_RunPath);
 }
 
 //*************************************************************************************
@@ -91,3 +130,28 @@ std::string ServiceProcess::GetRunPath() const noexcept
 {
     return s_RunPath;
 }
+
+size_t ServiceProcess::GetSendQueueDepth() const noexcept
+{
+    return EventQueue::GetSendQueueDepth();
+}
+
+MRH_Uint64 ServiceProcess::GetSendQueueDrained() const noexcept
+{
+    return EventQueue::GetSendQueueDrained();
+}
+
+int ServiceProcess::GetRecievePollFD() const noexcept
+{
+    return EventQueue::GetRecievePollFD();
+}
+
+int ServiceProcess::GetSendPollFD() const noexcept
+{
+    return EventQueue::GetSendPollFD();
+}
+
+std::string ServiceProcess::GetTransportInfo() const
+{
+    return EventQueue::GetTransportInfo();
+}
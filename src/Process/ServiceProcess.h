@@ -41,6 +41,29 @@ public:
     
     virtual ~ServiceProcess() noexcept;
     
+    //*************************************************************************************
+    // Transport
+    //*************************************************************************************
+    
+    /**
+     *  Set the transport settings. The settings are applied on the next run.
+     *
+     *  \param us_PipeSize The pipe capacity in bytes, 0 for the kernel default.
+     *  \param us_ReadBatchSize The recieve buffer size in bytes, 0 for the default.
+     *  \param u32_WriteBatchSize The max amount of events per send batch, 0 for no limit.
+     */
+    
+    void SetTransport(size_t us_PipeSize, size_t us_ReadBatchSize, MRH_Uint32 u32_WriteBatchSize) noexcept;
+    
+    /**
+     *  Set the highest event wire format version offered to the process.
+     *  The version is applied on the next run.
+     *
+     *  \param u32_WireVersion The wire format version, 2 to offer batches.
+     */
+    
+    void SetWireVersion(MRH_Uint32 u32_WireVersion) noexcept;
+    
     //*************************************************************************************
     // Recieve
     //*************************************************************************************
@@ -61,6 +84,14 @@ public:
      */
     
     virtual std::vector<Event>& RetrieveEvents() noexcept;
+    
+    /**
+     *  Prepare for an external wait on the recieve poll file descriptor.
+     *
+     *  \return true if the process can be waited on, false if events are already readable.
+     */
+    
+    bool PrepareRecievePoll() noexcept;
 
     //*************************************************************************************
     // Send
@@ -90,6 +121,17 @@ public:
      */
 
     virtual void SendEvents(std::vector<Event>& v_Event, MRH_Uint32 u32_EventLimit) noexcept;
+    
+    //*************************************************************************************
+    // Statistics
+    //*************************************************************************************
+    
+    /**
+     *  Log the process event queue statistics. Only a single thread should
+     *  log the statistics of a process.
+     */
+    
+    void LogStatistics() noexcept;
 
     //*************************************************************************************
     // Getters
@@ -119,6 +161,49 @@ public:
     
     std::string GetRunPath() const noexcept;
     
+    /**
+     *  Get the amount of events waiting to be sent. This function is thread safe.
+     *
+     *  \return The send queue depth.
+     */
+    
+    size_t GetSendQueueDepth() const noexcept;
+    
+    /**
+     *  Get the total amount of events sent to the process. This function is
+     *  thread safe.
+     *
+     *  \return The sent event count.
+     */
+    
+    MRH_Uint64 GetSendQueueDrained() const noexcept;
+    
+    /**
+     *  Get the file descriptor which becomes readable once events can be
+     *  recieved.
+     *
+     *  \return The file descriptor on success, -1 if not available.
+     */
+    
+    int GetRecievePollFD() const noexcept;
+    
+    /**
+     *  Get the file descriptor which becomes writable once events can be
+     *  sent.
+     *
+     *  \return The file descriptor on success, -1 if not available.
+     */
+    
+    int GetSendPollFD() const noexcept;
+    
+    /**
+     *  Get a description of the effective transport settings.
+     *
+     *  \return The transport description.
+     */
+    
+    std::string GetTransportInfo() const;
+
 private:
 
     //*************************************************************************************
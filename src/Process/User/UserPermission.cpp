@@ -29,13 +29,28 @@
 //*************************************************************************************
 
 UserPermission::UserPermission(bool b_IsService) noexcept : b_IsService(b_IsService), // Filtering
-                                                            b_PasswordVerified(false)
+                                                            b_PasswordVerified(false),
+                                                            u32_PasswordRevision(0)
 {
     // Set intial permission info (all blocked)
     for (size_t i = 0; i < Package::EVENT_PERMISSION_LIST_COUNT; ++i)
     {
         p_Permission[i] = Package::u32_NoPermission;
     }
+    
+    for (size_t i = 0; i < us_MapSize; ++i)
+    {
+        p_AllowedMap[i] = 0;
+        p_PasswordMap[i] = 0;
+    }
+    
+    // Fixed permissions for events which are always or never allowed
+    p_Permission[EventMeta::PERMISSION_ALWAYS] = EventMeta::u32_PermissionAny;
+    p_Permission[EventMeta::PERMISSION_NEVER] = Package::u32_NoPermission;
+    
+    // Build maps for the initial info
+    UpdatePermissionMap();
+    UpdatePasswordMap();
 }
 
 UserPermission::~UserPermission() noexcept
@@ -59,6 +74,10 @@ void UserPermission::UpdatePermissions(Package const& c_Package)
         throw ProcessException(e.what2()); // Convert to keep in line with expected exceptions
     }
     
+    // Compile permissions for filtering, protected events might have changed
+    UpdatePermissionMap();
+    UpdatePasswordMap();
+    
     // OS Apps don't require password authentification, considered safe
     if (c_Package.PackageApp::GetOSAppType() > PackageConfiguration::OSAppType::NONE)
     {
@@ -71,16 +90,18 @@ void UserPermission::UpdatePermissions(Package const& c_Package)
 }
 
 //*************************************************************************************
-// Permission Event Filter
+// Event Filter
 //*************************************************************************************
 
-void UserPermission::FilterEventsPermission(std::vector<Event>& v_Event, bool b_AddResponseEvent) noexcept
+bool UserPermission::FilterEvents(std::vector<Event>& v_Event, Filter const& c_Filter) noexcept
 {
-    Logger& c_Logger = Logger::Singleton();
-    
-    MRH_Uint32 u32_CurrentEvent;
+    MRH_Uint32 p_Rejected[REJECT_COUNT] = { 0 };
+    MRH_Uint32 u32_Type;
     MRH_Uint32 u32_ResponseEvent;
-    bool b_EventDenied = false;
+    bool b_Permission = (c_Filter.u32_Stage & FILTER_PERMISSION) != 0;
+    bool b_ResetFound = false;
+    bool b_AddResponseEvent = c_Filter.b_AddResponseEvent;
+    size_t us_Keep = 0;
     
     // Services cannot recieve events
     if (b_IsService == true)
@@ -88,84 +109,156 @@ void UserPermission::FilterEventsPermission(std::vector<Event>& v_Event, bool b_
         b_AddResponseEvent = false;
     }
     
-    for (auto Event = v_Event.begin(); Event != v_Event.end();)
+    // Classify all events at once for the permission stage
+    if (b_Permission == true)
     {
-        u32_CurrentEvent = Event->GetType();
+        // Protected events were reloaded since the last filter?
+        if (ProtectedEventList::Singleton().GetRevision() != u32_PasswordRevision)
+        {
+            UpdatePasswordMap();
+        }
         
-        // Event permissions not met?
-        // @NOTE: Service events see the user process type as a permission
-        //        So, service events require a service, user application events a user application
-        if (IsServiceEvent(u32_CurrentEvent) != b_IsService || PermissionGiven(u32_CurrentEvent) == false)
+        GetFilterResults(v_Event, v_FilterResult);
+    }
+    
+    // Run all stages per event, kept events are moved to the front
+    for (size_t i = 0; i < v_Event.size(); ++i)
+    {
+        Event& c_Event = v_Event[i];
+        
+        u32_Type = c_Event.GetType();
+        EventMeta::Info const& c_Info = EventMeta::Get(u32_Type);
+        
+        // Special events only sent by services without requesting them
+        // are sent to anyone, so we can ignore the group ID here.
+        if ((c_Filter.u32_Stage & FILTER_GROUP_ID) != 0 &&
+            c_Info.b_GroupExempt == false &&
+            c_Event.GetGroupID() != c_Filter.u32_GroupID)
         {
-            c_Logger.Log(Logger::WARNING, "Cannot send user process event: Missing permissions for event " +
-                                          std::to_string(u32_CurrentEvent) +
-                                          "!",
-                         "UserPermission.cpp", __LINE__);
-            
-            u32_ResponseEvent = MRH_EVENT_PERMISSION_DENIED;
-            b_EventDenied = true;
+            ++p_Rejected[REJECT_GROUP_ID];
+            continue;
         }
-        else if (b_PasswordVerified == false && PasswordProtected(u32_CurrentEvent) == true)
+        
+        if ((c_Filter.u32_Stage & FILTER_VERSION) != 0 &&
+            GetVersionSupported(u32_Type, c_Filter.i_EventVer) == false)
         {
-            c_Logger.Log(Logger::WARNING, "Cannot send user process event: Password verification required for event " +
-                                          std::to_string(u32_CurrentEvent) +
-                                          "!",
-                         "UserPermission.cpp", __LINE__);
-            
-            u32_ResponseEvent = MRH_EVENT_PASSWORD_REQUIRED;
-            b_EventDenied = true;
+            ++p_Rejected[REJECT_VERSION];
+            continue;
         }
         
-        // Handle event
-        if (b_EventDenied == true)
+        // Remove all events before the reset request
+        if ((c_Filter.u32_Stage & FILTER_RESET_REQUEST) != 0 && b_ResetFound == false)
         {
-            if (b_AddResponseEvent == true)
+            if (u32_Type != MRH_EVENT_PS_RESET_REQUEST_U)
             {
-                v_PermissionDenied.emplace_back(Event->GetGroupID(), /* Keep group id, same process (0 for service) */
-                                                u32_ResponseEvent,
-                                                (MRH_Uint8*)&(u32_CurrentEvent), /* Match event buffer, contains event id */
-                                                sizeof(u32_CurrentEvent));
+                ++p_Rejected[REJECT_RESET_REQUEST];
+                continue;
             }
             
-            Event = v_Event.erase(Event);
-            b_EventDenied = false;
+            b_ResetFound = true;
         }
-        else
-        {
-            ++Event;
-        }
-    }
-}
-
-void UserPermission::FilterEventsVersion(std::vector<Event>& v_Event, int i_EventVer) noexcept
-{
-    for (auto Event = v_Event.begin(); Event != v_Event.end();)
-    {
-        switch (i_EventVer)
+        
+        if (b_Permission == true)
         {
-            /**
-             *  Event Version 1
-             */
-                
-            case 1:
-                if (Event->GetType() > MRH_EVENT_TYPE_MAX)
+            // Malformed events are dropped without response
+            if (c_Event.GetDataSize() < c_Info.u32_MinDataSize)
+            {
+                ++p_Rejected[REJECT_MALFORMED];
+                continue;
+            }
+            
+            // @NOTE: Service events see the user process type as a permission
+            //        So, service events require a service, user application events a user application
+            // @NOTE: Events without a filter result are treated as denied
+            MRH_Uint8 u8_Result = (i < v_FilterResult.size() ? v_FilterResult[i] : static_cast<MRH_Uint8>(EVENT_PERMISSION_DENIED));
+            
+            if (u8_Result != EVENT_ALLOWED)
+            {
+                if (u8_Result == EVENT_PASSWORD_REQUIRED)
                 {
-                    Event = v_Event.erase(Event);
+                    ++p_Rejected[REJECT_PASSWORD];
+                    u32_ResponseEvent = MRH_EVENT_PASSWORD_REQUIRED;
                 }
                 else
                 {
-                    ++Event;
+                    ++p_Rejected[REJECT_PERMISSION];
+                    u32_ResponseEvent = MRH_EVENT_PERMISSION_DENIED;
                 }
-                break;
                 
-            /**
-             *  Default
-             */
+                if (b_AddResponseEvent == true)
+                {
+                    v_PermissionDenied.emplace_back(c_Event.GetGroupID(), /* Keep group id, same process (0 for service) */
+                                                    u32_ResponseEvent,
+                                                    (MRH_Uint8*)&(u32_Type), /* Match event buffer, contains event id */
+                                                    sizeof(u32_Type));
+                }
                 
-            default:
-                Event = v_Event.erase(Event);
-                break;
+                continue;
+            }
         }
+        
+        // Event passed, keep
+        if (us_Keep != i)
+        {
+            v_Event[us_Keep] = std::move(c_Event);
+        }
+        
+        ++us_Keep;
+    }
+    
+    if (us_Keep == v_Event.size())
+    {
+        return b_ResetFound;
+    }
+    
+    v_Event.erase(v_Event.begin() + us_Keep, v_Event.end());
+    
+    // Log once for the whole batch
+    Logger::Singleton().Log(Logger::WARNING, "Filtered user process events: Wrong group " +
+                                             std::to_string(p_Rejected[REJECT_GROUP_ID]) +
+                                             ", unsupported version " +
+                                             std::to_string(p_Rejected[REJECT_VERSION]) +
+                                             ", reset not requested " +
+                                             std::to_string(p_Rejected[REJECT_RESET_REQUEST]) +
+                                             ", malformed " +
+                                             std::to_string(p_Rejected[REJECT_MALFORMED]) +
+                                             ", missing permissions " +
+                                             std::to_string(p_Rejected[REJECT_PERMISSION]) +
+                                             ", password required " +
+                                             std::to_string(p_Rejected[REJECT_PASSWORD]) +
+                                             ".",
+                            "UserPermission.cpp", __LINE__);
+    
+    return b_ResetFound;
+}
+
+void UserPermission::GetFilterResults(std::vector<Event> const& v_Event, std::vector<MRH_Uint8>& v_Result) noexcept
+{
+    // @NOTE: Verified clears all password bits, no branching per event
+    MRH_Uint64 u64_PasswordMask = (b_PasswordVerified == true ? 0 : 1);
+    MRH_Uint64 u64_Allowed;
+    MRH_Uint64 u64_Password;
+    size_t us_Count = v_Event.size();
+    
+    try
+    {
+        v_Result.resize(us_Count);
+    }
+    catch (...)
+    {
+        // Only check the events we have results for
+        us_Count = v_Result.size();
+    }
+    
+    for (size_t i = 0; i < us_Count; ++i)
+    {
+        MRH_Uint32 u32_Type = v_Event[i].GetType();
+        
+        u64_Allowed = GetMapBit(p_AllowedMap, u32_Type);
+        u64_Password = GetMapBit(p_PasswordMap, u32_Type) & u64_PasswordMask;
+        
+        // Denied (1) if not allowed, password required (2) if allowed but protected
+        v_Result[i] = static_cast<MRH_Uint8>((u64_Allowed ^ 1) | ((u64_Allowed & u64_Password) << 1));
     }
 }
 
@@ -173,224 +266,98 @@ void UserPermission::FilterEventsVersion(std::vector<Event>& v_Event, int i_Even
 // Event Permissions
 //*************************************************************************************
 
-bool UserPermission::PermissionGiven(MRH_Uint32 u32_Type) noexcept
+bool UserPermission::PermissionGiven(EventMeta::Info const& c_Info) const noexcept
 {
-    switch (u32_Type)
-    {
-        /**
-         *  Event Version 1
-         */
-            
-        // Unknown, error or default value
-        case MRH_EVENT_UNK:
-            return false;
-            
-        // Missing permissions
-        case MRH_EVENT_PERMISSION_DENIED:
-            return true;
-            
-        // Not implemented by service
-        case MRH_EVENT_NOT_IMPLEMENTED_S:
-            return true;
-            
-        // Service reset
-        case MRH_EVENT_PS_RESET_REQUEST_U:
-        case MRH_EVENT_PS_RESET_ACKNOLEDGED_U:
-            return true;
-            
-        // Custom service
-        case MRH_EVENT_CUSTOM_AVAIL_U:
-        case MRH_EVENT_CUSTOM_AVAIL_S:
-        case MRH_EVENT_CUSTOM_CUSTOM_COMMAND_U:
-        case MRH_EVENT_CUSTOM_CUSTOM_COMMAND_S:
-            return p_Permission[Package::CUSTOM] > PermissionCustom::CUSTOM_NONE;
-            
-        // Voice - Listen
-        case MRH_EVENT_LISTEN_AVAIL_U:
-        case MRH_EVENT_LISTEN_AVAIL_S:
-            return p_Permission[Package::LISTEN] > PermissionListen::LISTEN_NONE;
-        case MRH_EVENT_LISTEN_STRING_S:
-            return p_Permission[Package::LISTEN] & PermissionListen::LISTEN_LISTEN;
-        case MRH_EVENT_LISTEN_GET_METHOD_U:
-        case MRH_EVENT_LISTEN_GET_METHOD_S:
-            return p_Permission[Package::LISTEN] & PermissionListen::LISTEN_GET_METHOD;
-        case MRH_EVENT_LISTEN_CUSTOM_COMMAND_U:
-        case MRH_EVENT_LISTEN_CUSTOM_COMMAND_S:
-            return p_Permission[Package::LISTEN] & PermissionListen::LISTEN_CUSTOM_COMMAND;
-            
-        // Voice - Say
-        case MRH_EVENT_SAY_AVAIL_U:
-        case MRH_EVENT_SAY_AVAIL_S:
-            return p_Permission[Package::SAY] > PermissionSay::SAY_NONE;
-        case MRH_EVENT_SAY_STRING_U:
-        case MRH_EVENT_SAY_STRING_S:
-            return p_Permission[Package::SAY] & PermissionSay::SAY_SAY;
-        case MRH_EVENT_SAY_GET_METHOD_U:
-        case MRH_EVENT_SAY_GET_METHOD_S:
-            return p_Permission[Package::SAY] & PermissionSay::SAY_GET_METHOD;
-        case MRH_EVENT_SAY_NOTIFICATION_APP_U:
-        case MRH_EVENT_SAY_NOTIFICATION_APP_S:
-            return p_Permission[Package::SAY] & PermissionSay::SAY_NOTIFICATION_APP;
-        case MRH_EVENT_SAY_NOTIFICATION_SERVICE_U:
-            return p_Permission[Package::SAY] & PermissionSay::SAY_NOTIFICATION_SERVICE;
-        case MRH_EVENT_SAY_CUSTOM_COMMAND_U:
-        case MRH_EVENT_SAY_CUSTOM_COMMAND_S:
-            return p_Permission[Package::SAY] & PermissionSay::SAY_CUSTOM_COMMAND;
-            
-        // Password
-        case MRH_EVENT_PASSWORD_AVAIL_U:
-        case MRH_EVENT_PASSWORD_AVAIL_S:
-            return p_Permission[Package::PASSWORD] > PermissionPassword::PASSWORD_NONE;
-        case MRH_EVENT_PASSWORD_CHECK_U:
-        case MRH_EVENT_PASSWORD_CHECK_S:
-            return p_Permission[Package::PASSWORD] & PermissionPassword::PASSWORD_CHECK;
-        case MRH_EVENT_PASSWORD_SET_U:
-        case MRH_EVENT_PASSWORD_SET_S:
-            return p_Permission[Package::PASSWORD] & PermissionPassword::PASSWORD_SET;
-        case MRH_EVENT_PASSWORD_CUSTOM_COMMAND_U:
-        case MRH_EVENT_PASSWORD_CUSTOM_COMMAND_S:
-            return p_Permission[Package::PASSWORD] & PermissionPassword::PASSWORD_CUSTOM_COMMAND;
-            
-        // User
-        case MRH_EVENT_USER_AVAIL_U:
-        case MRH_EVENT_USER_AVAIL_S:
-            return p_Permission[Package::USER] > PermissionUser::USER_NONE;
-        case MRH_EVENT_USER_ACCESS_DOCUMENTS_U:
-        case MRH_EVENT_USER_ACCESS_DOCUMENTS_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_DOCUMENTS_ACCESS;
-        case MRH_EVENT_USER_ACCESS_PICTURES_U:
-        case MRH_EVENT_USER_ACCESS_PICTURES_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_PICTURES_ACCESS;
-        case MRH_EVENT_USER_ACCESS_MUSIC_U:
-        case MRH_EVENT_USER_ACCESS_MUSIC_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_MUSIC_ACCESS;
-        case MRH_EVENT_USER_ACCESS_VIDEOS_U:
-        case MRH_EVENT_USER_ACCESS_VIDEOS_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_VIDEOS_ACCESS;
-        case MRH_EVENT_USER_ACCESS_DOWNLOADS_U:
-        case MRH_EVENT_USER_ACCESS_DOWNLOADS_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_DOWNLOADS_ACCESS;
-        case MRH_EVENT_USER_ACCESS_CLIPBOARD_U:
-        case MRH_EVENT_USER_ACCESS_CLIPBOARD_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_CLIPBOARD_ACCESS;
-        case MRH_EVENT_USER_ACCESS_INFO_PERSON_U:
-        case MRH_EVENT_USER_ACCESS_INFO_PERSON_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_INFO_PERSON_ACCESS;
-        case MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_U:
-        case MRH_EVENT_USER_ACCESS_INFO_RESIDENCE_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_INFO_RESIDENCE_ACCESS;
-        case MRH_EVENT_USER_ACCESS_CLEAR_U:
-        case MRH_EVENT_USER_ACCESS_CLEAR_S:
-            if (p_Permission[Package::USER] & PermissionUser::USER_DOCUMENTS_ACCESS ||
-                p_Permission[Package::USER] & PermissionUser::USER_PICTURES_ACCESS ||
-                p_Permission[Package::USER] & PermissionUser::USER_MUSIC_ACCESS ||
-                p_Permission[Package::USER] & PermissionUser::USER_VIDEOS_ACCESS ||
-                p_Permission[Package::USER] & PermissionUser::USER_DOWNLOADS_ACCESS ||
-                p_Permission[Package::USER] & PermissionUser::USER_CLIPBOARD_ACCESS ||
-                p_Permission[Package::USER] & PermissionUser::USER_INFO_PERSON_ACCESS ||
-                p_Permission[Package::USER] & PermissionUser::USER_INFO_RESIDENCE_ACCESS)
-            {
-                return true;
-            }
-            return false;
-        case MRH_EVENT_USER_GET_LOCATION_U:
-        case MRH_EVENT_USER_GET_LOCATION_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_GET_LOCATION;
-        case MRH_EVENT_USER_CUSTOM_COMMAND_U:
-        case MRH_EVENT_USER_CUSTOM_COMMAND_S:
-            return p_Permission[Package::USER] & PermissionUser::USER_CUSTOM_COMMAND;
-            
-        // Application
-        case MRH_EVENT_APP_AVAIL_U:
-        case MRH_EVENT_APP_AVAIL_S:
-            return p_Permission[Package::APP] > PermissionApplication::APPLICATION_NONE;
-        case MRH_EVENT_APP_LAUNCH_SOA_U:
-        case MRH_EVENT_APP_LAUNCH_SOA_S:
-            return p_Permission[Package::APP] & PermissionApplication::APPLICATION_LAUNCH;
-        case MRH_EVENT_APP_LAUNCH_SOA_TIMER_U:
-        case MRH_EVENT_APP_LAUNCH_SOA_TIMER_S:
-            return p_Permission[Package::APP] & PermissionApplication::APPLICATION_LAUNCH_TIMER;
-        case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_U:
-        case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_S:
-            return p_Permission[Package::APP] & PermissionApplication::APPLICATION_CLEAR_LAUNCH;
-        case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_U:
-        case MRH_EVENT_APP_LAUNCH_SOA_CLEAR_TIMER_S:
-            return p_Permission[Package::APP] & PermissionApplication::APPLICATION_CLEAR_LAUNCH_TIMER;
-        case MRH_EVENT_APP_LAUNCH_SOA_TIMER_REMINDER_S:
-            return true; // Reminder to close for other app should always be recievable!
-        case MRH_EVENT_APP_CUSTOM_COMMAND_U:
-        case MRH_EVENT_APP_CUSTOM_COMMAND_S:
-            return p_Permission[Package::APP] & PermissionApplication::APPLICATION_CUSTOM_COMMAND;
-            
-        /**
-         *  Unk
-         */
-            
-        // Default
-        default:
-            return false;
-    }
+    // @NOTE: Always and never allowed events use the fixed permission entries
+    return (p_Permission[c_Info.u32_Permission] & c_Info.u32_PermissionMask) != 0;
 }
 
 //*************************************************************************************
-// Event Password Protection
+// Event Service Restriction
+//*************************************************************************************
+
+bool UserPermission::IsServiceEvent(EventMeta::Info const& c_Info) const noexcept
+{
+    return c_Info.b_UserService;
+}
+
+//*************************************************************************************
+// Event Version
 //*************************************************************************************
 
-bool UserPermission::PasswordProtected(MRH_Uint32 u32_Type) noexcept
+bool UserPermission::GetVersionSupported(MRH_Uint32 u32_Type, int i_EventVer) const noexcept
 {
-    switch (u32_Type)
+    switch (i_EventVer)
     {
-        // Some events are never protected, even on list (system events, etc)
-     
         /**
          *  Event Version 1
          */
-            
-        // System
-        case MRH_EVENT_UNK:
-        case MRH_EVENT_PERMISSION_DENIED:
-        case MRH_EVENT_PASSWORD_REQUIRED:
-        case MRH_EVENT_NOT_IMPLEMENTED_S:
-        case MRH_EVENT_PS_RESET_REQUEST_U:
-        case MRH_EVENT_PS_RESET_ACKNOLEDGED_U:
-            
-        // Say
-        case MRH_EVENT_SAY_STRING_S: // Only recieved if SAY_U was used, and that can be password protected (also: No info on what was said)
-            
-        // Password
-        case MRH_EVENT_PASSWORD_CHECK_U: // Blocking password checking by password blocks all password protection and makes no sense
-        case MRH_EVENT_PASSWORD_CHECK_S:
-            
-        // Applications
-        case MRH_EVENT_APP_LAUNCH_SOA_TIMER_REMINDER_S: // Reminder sent from service
-            
-        // Service
-        case MRH_EVENT_SAY_NOTIFICATION_SERVICE_U: // Can't react to password event
-            return false;
-            
+        
+        case 1:
+            return u32_Type <= MRH_EVENT_TYPE_MAX;
+        
         /**
-         *  Unk
+         *  Default
          */
-            
+        
         default:
-            return ProtectedEventList::Singleton().GetEventProtected(u32_Type);
+            return false;
     }
 }
 
 //*************************************************************************************
-// Event Service Restriction
+// Event Maps
 //*************************************************************************************
 
-bool UserPermission::IsServiceEvent(MRH_Uint32 u32_Type) noexcept
+void UserPermission::UpdatePermissionMap() noexcept
 {
-    switch (u32_Type)
+    for (size_t i = 0; i < us_MapSize; ++i)
     {
-        // Services have little in terms of events, just list allowed ones
-        case MRH_EVENT_SAY_NOTIFICATION_SERVICE_U:
-            return true;
-            
-        default:
-            return false;
+        p_AllowedMap[i] = 0;
+    }
+    
+    for (MRH_Uint32 i = 0; i < MRH_EVENT_TYPE_COUNT; ++i)
+    {
+        EventMeta::Info const& c_Info = EventMeta::Get(i);
+        
+        // Service events require a service, user application events a user application
+        if (IsServiceEvent(c_Info) == b_IsService && PermissionGiven(c_Info) == true)
+        {
+            p_AllowedMap[i >> 6] |= (static_cast<MRH_Uint64>(1) << (i & 63));
+        }
+    }
+}
+
+void UserPermission::UpdatePasswordMap() noexcept
+{
+    ProtectedEventList& c_List = ProtectedEventList::Singleton();
+    
+    try
+    {
+        u32_PasswordRevision = c_List.GetEvents(v_Protected);
+    }
+    catch (ConfigurationException& e)
+    {
+        // Keep the old map, retried on next filter
+        Logger::Singleton().Log(Logger::WARNING, "Failed to get protected events: " + e.what2(),
+                                "UserPermission.cpp", __LINE__);
+        return;
+    }
+    
+    for (size_t i = 0; i < us_MapSize; ++i)
+    {
+        p_PasswordMap[i] = 0;
+    }
+    
+    for (auto& Protected : v_Protected)
+    {
+        // Some events are never protected, even on list (system events, etc)
+        if (Protected > MRH_EVENT_TYPE_MAX || EventMeta::Get(Protected).b_PasswordExempt == true)
+        {
+            continue;
+        }
+        
+        p_PasswordMap[Protected >> 6] |= (static_cast<MRH_Uint64>(1) << (Protected & 63));
     }
 }
 
@@ -21,9 +21,11 @@
 #include <vector>
 
 // External
+#include <MRH_Typedefs.h>
 
 // Project
 #include "../../Package/Package.h"
+#include "../../Event/EventMeta.h"
 #include "../../Event/Event.h"
 #include "../ProcessException.h"
 
@@ -65,133 +67,149 @@ private:
     /**
      *  Check if the permissions required for a event are available.
      *
-     *  \param u32_Type The event type to check permissions for.
+     *  \param c_Info The metadata of the event type to check permissions for.
      *
      *  \return true if the permission set contains the required permissions,
      *          false if not.
      */
 
-    bool PermissionGiven(MRH_Uint32 u32_Type) noexcept;
+    bool PermissionGiven(EventMeta::Info const& c_Info) const noexcept;
 
     //*************************************************************************************
-    // Event Password Protection
+    // Event Service Restriction
     //*************************************************************************************
     
     /**
-     *  Check if a given event is password protected.
+     *  Check if a given event is intended for user services.
+     *
+     *  \param c_Info The metadata of the event type to check.
+     *
+     *  \return true if the event is available to user services, false if not.
+     */
+    
+    bool IsServiceEvent(EventMeta::Info const& c_Info) const noexcept;
+    
+    //*************************************************************************************
+    // Event Version
+    //*************************************************************************************
+    
+    /**
+     *  Check if a event type is supported by a event version.
      *
      *  \param u32_Type The event type to check.
+     *  \param i_EventVer The given event version.
      *
-     *  \return true if the event is password protected, false if not.
+     *  \return true if the event is supported, false if not.
      */
-
-    bool PasswordProtected(MRH_Uint32 u32_Type) noexcept;
+    
+    bool GetVersionSupported(MRH_Uint32 u32_Type, int i_EventVer) const noexcept;
     
     //*************************************************************************************
-    // Event Service Restriction
+    // Event Maps
     //*************************************************************************************
     
     /**
-     *  Check if a given event is intended for user services.
+     *  Rebuild the allowed event map from the current permissions.
+     */
+    
+    void UpdatePermissionMap() noexcept;
+    
+    /**
+     *  Rebuild the password required event map from the protected event list.
+     */
+    
+    void UpdatePasswordMap() noexcept;
+    
+    /**
+     *  Check if a event type is set in a event map.
      *
+     *  \param p_Map The event map to check.
      *  \param u32_Type The event type to check.
      *
-     *  \return true if the event is available to user services, false if not.
+     *  \return 1 if the type is set, 0 if not.
      */
     
-    bool IsServiceEvent(MRH_Uint32 u32_Type) noexcept;
+    static inline MRH_Uint64 GetMapBit(MRH_Uint64 const* p_Map, MRH_Uint32 u32_Type) noexcept
+    {
+        // @NOTE: Unknown types share the last bit, which is never set
+        MRH_Uint32 u32_Bit = u32_Type < MRH_EVENT_TYPE_COUNT ? u32_Type : static_cast<MRH_Uint32>(MRH_EVENT_TYPE_COUNT);
+        return (p_Map[u32_Bit >> 6] >> (u32_Bit & 63)) & 1;
+    }
     
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
+    static constexpr size_t us_MapSize = (MRH_EVENT_TYPE_COUNT + 1 + 63) / 64;
+    
     bool b_IsService;
     
-    Package::EventPermission p_Permission[Package::EVENT_PERMISSION_LIST_COUNT];
+    // Package permissions followed by the fixed event meta permissions
+    Package::EventPermission p_Permission[EventMeta::PERMISSION_COUNT];
     bool b_PasswordVerified;
     
+    // Bit per event type, unknown types use the last bit
+    MRH_Uint64 p_AllowedMap[us_MapSize];
+    MRH_Uint64 p_PasswordMap[us_MapSize];
+    MRH_Uint32 u32_PasswordRevision;
+    std::vector<MRH_Uint32> v_Protected;
+
 protected:
     
     //*************************************************************************************
-    // Permissions
+    // Types
     //*************************************************************************************
-
-    // @NOTE: Bit flags are used (1, 2, 4, 8, etc.) to allow for combining permissions!
-    typedef enum
-    {
-        /* Event Version 1 */
-        
-        CUSTOM_NONE = 0,                         // No custom service permissions
-        CUSTOM_USABLE = 1,                       // Custom service usage enabled
     
-    }PermissionCustom;
-
     typedef enum
     {
-        /* Event Version 1 */
+        EVENT_ALLOWED = 0,
+        EVENT_PERMISSION_DENIED = 1,
+        EVENT_PASSWORD_REQUIRED = 2,
         
-        APPLICATION_NONE = 0,                    // No application permissions
-        APPLICATION_LAUNCH = 1,                  // Launch application by path
-        APPLICATION_CLEAR_LAUNCH = 2,            // Clear application launch request
-        APPLICATION_LAUNCH_TIMER = 4,            // Timed application launch by path
-        APPLICATION_CLEAR_LAUNCH_TIMER = 8,      // Clear all timed application launches request
-        APPLICATION_CUSTOM_COMMAND = 16,         // Allow sending and recieving of custom commands
-    
-    }PermissionApplication;
-
-    typedef enum
-    {
-        /* Event Version 1 */
+        FILTER_RESULT_MAX = EVENT_PASSWORD_REQUIRED,
+        
+        FILTER_RESULT_COUNT = FILTER_RESULT_MAX + 1
         
-        LISTEN_NONE = 0,                         // No listen permissions
-        LISTEN_LISTEN = 1,                       // Speech listen events
-        LISTEN_GET_METHOD = 2,                   // Get speech input method
-        LISTEN_CUSTOM_COMMAND = 4,               // Allow sending and recieving of custom commands
+    }FilterResult;
     
-    }PermissionListen;
-
+    // @NOTE: Bit flags are used to allow for combining filter stages!
     typedef enum
     {
-        /* Event Version 1 */
+        FILTER_GROUP_ID = 1,                     // Events require the process group id
+        FILTER_VERSION = 2,                      // Events require the process event version
+        FILTER_RESET_REQUEST = 4,                // Events before the reset request are removed
+        FILTER_PERMISSION = 8,                   // Events require permissions and password verification
         
-        SAY_NONE = 0,                            // No say permissions
-        SAY_SAY = 1,                             // Speech say events
-        SAY_GET_METHOD = 2,                      // Get speech output method
-        SAY_NOTIFICATION_APP = 4,                // Send notification from app 
-        SAY_NOTIFICATION_SERVICE = 8,            // Send notification from service
-        SAY_CUSTOM_COMMAND = 16,                  // Allow sending and recieving of custom commands
-    
-    }PermissionSay;
-
+    }FilterStage;
+    
     typedef enum
     {
-        /* Event Version 1 */
+        REJECT_GROUP_ID = 0,
+        REJECT_VERSION = 1,
+        REJECT_RESET_REQUEST = 2,
+        REJECT_MALFORMED = 3,
+        REJECT_PERMISSION = 4,
+        REJECT_PASSWORD = 5,
+        
+        REJECT_MAX = REJECT_PASSWORD,
+        
+        REJECT_COUNT = REJECT_MAX + 1
         
-        PASSWORD_NONE = 0,                       // No password permissions
-        PASSWORD_CHECK = 1,                      // Check user password
-        PASSWORD_SET = 2,                        // Set user password
-        PASSWORD_CUSTOM_COMMAND = 4,             // Allow sending and recieving of custom commands
+    }Rejection;
     
-    }PermissionPassword;
-
-    typedef enum
+    struct Filter
     {
-        /* Event Version 1 */
+        // Combined filter stages to run
+        MRH_Uint32 u32_Stage;
         
-        USER_NONE = 0,                           // No user permissions
-        USER_DOCUMENTS_ACCESS = 1,               // Access user documents
-        USER_PICTURES_ACCESS = 2,                // Access user pictures
-        USER_MUSIC_ACCESS = 4,                   // Access user music
-        USER_VIDEOS_ACCESS = 8,                  // Access user videos
-        USER_DOWNLOADS_ACCESS = 16,              // Access user downloads
-        USER_CLIPBOARD_ACCESS = 32,              // Access user clipboard
-        USER_INFO_PERSON_ACCESS = 64,            // Access user person info
-        USER_INFO_RESIDENCE_ACCESS = 128,        // Access user residence info
-        USER_GET_LOCATION = 256,                 // Request user location
-        USER_CUSTOM_COMMAND = 512,               // Allow sending and recieving of custom commands
-    
-    }PermissionUser;
-
+        // Stage values
+        MRH_Uint32 u32_GroupID;
+        int i_EventVer;
+        
+        // Add response events for each event with missing permissions
+        bool b_AddResponseEvent;
+    };
+    
     //*************************************************************************************
     // Constructor / Destructor
     //*************************************************************************************
@@ -235,28 +253,33 @@ protected:
     //*************************************************************************************
 
     /**
-     *  Filter user application events based on available permissions and password verification.
+     *  Get the filter result for all events in a event vector. Events
+     *  without a result should be treated as denied.
      *
      *  \param v_Event The event vector to check.
-     *  \param b_AddResponseEvent Add response events for each event with missing permissions.
+     *  \param v_Result The vector to replace with the filter result for each event.
      */
-     
-    void FilterEventsPermission(std::vector<Event>& v_Event, bool b_AddResponseEvent) noexcept;
+    
+    void GetFilterResults(std::vector<Event> const& v_Event, std::vector<MRH_Uint8>& v_Result) noexcept;
     
     /**
-     *  Filter events based on the process event version supported.
+     *  Filter events with all given filter stages in a single pass. Removed
+     *  events keep the order of the remaining events.
      *
-     *  \param v_Event The event vector to check.
-     *  \param i_EventVer The given event version.
+     *  \param v_Event The event vector to filter.
+     *  \param c_Filter The filter stages to run.
+     *
+     *  \return true if the reset request stage found a reset request, false if not.
      */
     
-    void FilterEventsVersion(std::vector<Event>& v_Event, int i_EventVer) noexcept;
+    bool FilterEvents(std::vector<Event>& v_Event, Filter const& c_Filter) noexcept;
     
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
     std::vector<Event> v_PermissionDenied;
+    std::vector<MRH_Uint8> v_FilterResult;
 };
 
 #endif /* UserPermission_h */
@@ -22,6 +22,8 @@
 // Project
 #include "./UserProcess.h"
 #include "./UserPermission.h"
+#include "../../Configuration/CoreConfiguration.h"
+#include "../../Event/EventMeta.h"
 #include "../../FilePaths.h"
 #include "../../Logger/Logger.h"
 #include "../../Logger/EventLogger.h"
@@ -43,10 +45,16 @@ namespace
 
 #ifdef __MRH_MRHCKM_SUPPORTED__
 UserProcess::UserProcess() : EventQueue(TransmissionSource::SourceType::MRHCKM),
-                             UserPermission(false)
+                             UserPermission(false),
+                             c_Throttle("user application",
+                                        CoreConfiguration::Singleton().GetSendHighWatermark(CoreConfiguration::USER_APP),
+                                        CoreConfiguration::Singleton().GetSendLowWatermark(CoreConfiguration::USER_APP))
 #else
 UserProcess::UserProcess() : EventQueue(TransmissionSource::SourceType::PIPE),
-                             UserPermission(false)
+                             UserPermission(false),
+                             c_Throttle("user application",
+                                        CoreConfiguration::Singleton().GetSendHighWatermark(CoreConfiguration::USER_APP),
+                                        CoreConfiguration::Singleton().GetSendLowWatermark(CoreConfiguration::USER_APP))
 #endif
 {
     // Initial event group start
@@ -60,9 +68,14 @@ UserProcess::UserProcess() : EventQueue(TransmissionSource::SourceType::PIPE),
     e_ResetState = REQUIRE_REQUEST;
     
     // Package
-#if MRH_CORE_EVENT_LOGGING > 0
     s_PackagePath = "<undefined>";
-#endif
+    
+    // Transport, applied on each run
+    CoreConfiguration& c_CoreConfiguration = CoreConfiguration::Singleton();
+    EventQueue::SetTransport(c_CoreConfiguration.GetPipeSize(CoreConfiguration::USER_APP),
+                             c_CoreConfiguration.GetReadBatchSize(CoreConfiguration::USER_APP),
+                             c_CoreConfiguration.GetWriteBatchSize(CoreConfiguration::USER_APP));
+    EventQueue::SetWireVersion(c_CoreConfiguration.GetWireVersion(CoreConfiguration::USER_APP));
 }
 
 UserProcess::~UserProcess() noexcept
@@ -80,6 +93,9 @@ UserProcess::~UserProcess() noexcept
 
 void UserProcess::Run(Package const& c_Package, int i_LaunchCommandID, std::string s_LaunchInput, std::string s_AppParentBinaryPath, MRH_Uint32 u32_EventLimit, MRH_Sint32 s32_RecieveTimeoutMS)
 {
+    // Clear the previous throttle state first, a failed launch keeps nothing
+    c_Throttle.Update(0);
+    
     // Re-create event queue
     try
     {
@@ -90,6 +106,13 @@ void UserProcess::Run(Package const& c_Package, int i_LaunchCommandID, std::stri
         throw ProcessException("Failed to reset event queue: " + e.what2());
     }
     
+#if MRH_CORE_EVENT_TRACING > 0
+    EventQueue::SetTraceEndpoint(c_Package.GetPackagePath());
+#endif
+    
+    Logger::Singleton().Log(Logger::INFO, "User process transport: " + EventQueue::GetTransportInfo(),
+                            "UserProcess.cpp", __LINE__);
+    
     // Get a new event group id
     while (u32_EventGroupID == u32_PreviousEventGroupID)
     {
@@ -156,10 +179,14 @@ void UserProcess::Run(Package const& c_Package, int i_LaunchCommandID, std::stri
         v_Arg.emplace_back(GetArgumentBytes(std::to_string(i_LaunchCommandID)));
         v_Arg.emplace_back(GetArgumentBytes(MRH_CORE_LAUNCH_INPUT_FILE_PATH));
         
+        // Legacy parents ignore the trailing wire format offer
+        if (GetWireVersion() > 1)
+        {
+            v_Arg.emplace_back(GetArgumentBytes(std::to_string(GetWireVersion())));
+        }
+        
         // Update the package path after a successfull launch
-#if MRH_CORE_EVENT_LOGGING > 0
         s_PackagePath = c_Package.GetPackagePath();
-#endif
     }
     catch (ProcessException& e)
     {
@@ -180,6 +207,8 @@ void UserProcess::Run(Package const& c_Package, int i_LaunchCommandID, std::stri
         throw;
     }
     
+    EventLogger::Singleton().LogProcess(EventLogFormat::USER, GetProcessID(), s_PackagePath);
+    
     // Write PID to file
     std::ofstream f_File(MRH_USER_PROCESS_PID_FILE_PATH, std::ios::trunc);
     
@@ -198,107 +227,81 @@ void UserProcess::Run(Package const& c_Package, int i_LaunchCommandID, std::stri
 }
 
 //*************************************************************************************
-// Process Event Filter
+// Recieve
 //*************************************************************************************
 
-void UserProcess::FilterEventsGroupID(std::vector<Event>& v_Event) noexcept
+void UserProcess::LogRecievedEvents(Event const& c_Event) noexcept
 {
-    for (auto Event = v_Event.begin(); Event != v_Event.end();)
-    {
-        switch (Event->GetType())
-        {
-            // Special events only sent by services without requesting them
-            // should be inserted here.
-            // These events would be sent to anyone, so we can ignore the group
-            // ID here.
-            case MRH_EVENT_LISTEN_STRING_S:
-            case MRH_EVENT_SAY_STRING_S:
-            case MRH_EVENT_APP_LAUNCH_SOA_TIMER_REMINDER_S:
-                ++Event;
-                break;
-                
-            default:
-                if (Event->GetGroupID() != u32_EventGroupID)
-                {
-                    Logger::Singleton().Log(Logger::WARNING, "Cannot send user app event: Wrong process event group " +
-                                                             std::to_string(Event->GetGroupID()) +
-                                                             "!",
-                                            "UserProcess.cpp", __LINE__);
-                    
-                    Event = v_Event.erase(Event);
-                }
-                else
-                {
-                    ++Event;
-                }
-                break;
-        }
-    }
+    EventLogger::Singleton().Log(c_Event, EventLogFormat::RECIEVED, EventLogFormat::USER, GetProcessID());
 }
 
-bool UserProcess::FilterEventsResetRequest(std::vector<Event>& v_Event) noexcept
+void UserProcess::RecieveEvents() noexcept
 {
-    while (v_Event.size() > 0)
+    // Limited by the platform service consumers
+    MRH_Uint32 u32_Limit = c_Throttle.GetEventLimit(u32_EventLimit);
+    
+    if (u32_Limit == 0)
     {
-        if (v_Event[0].GetType() == MRH_EVENT_PS_RESET_REQUEST_U)
-        {
-            return true;
-        }
-        
-        Logger::Singleton().Log(Logger::WARNING, "Cannot send user app event: Service reset not yet requested!",
-                                "UserProcess.cpp", __LINE__);
-        v_Event.erase(v_Event.begin());
+        return;
+    }
+    
+    // Sources with a poll fd are waited on by the caller
+    if (EventQueue::GetRecievePollFD() < 0)
+    {
+        EventQueue::RecieveEvents(u32_Limit, s32_RecieveTimeoutMS);
+    }
+    else
+    {
+        EventQueue::RecieveEvents(u32_Limit, 0);
     }
     
-    return false;
+    // A child which broke the transmission can't be trusted anymore
+    if (EventQueue::GetFailed() == true)
+    {
+        Stop(true);
+    }
 }
 
-//*************************************************************************************
-// Recieve
-//*************************************************************************************
+bool UserProcess::PrepareRecievePoll() noexcept
+{
+    return EventQueue::PrepareRecievePoll();
+}
 
-#if MRH_CORE_EVENT_LOGGING > 0
-void UserProcess::LogRecievedEvents(Event const& c_Event) noexcept
+int UserProcess::GetRecievePollFD() const noexcept
 {
-    EventLogger::Singleton().Log(c_Event, "Recieved event from user process: " + s_PackagePath);
+    return EventQueue::GetRecievePollFD();
 }
-#endif
 
-void UserProcess::RecieveEvents() noexcept
+bool UserProcess::GetRecieveThrottled() const noexcept
 {
-    EventQueue::RecieveEvents(u32_EventLimit, s32_RecieveTimeoutMS);
+    return c_Throttle.GetEventLimit(u32_EventLimit) == 0;
 }
 
 std::vector<Event>& UserProcess::RetrieveEvents() noexcept
 {
     std::vector<Event>& v_Event = EventQueue::RetrieveEvents();
     
-    // Filter events by group id first
-    FilterEventsGroupID(v_Event);
+    // Filter by group id, app permissions and password
+    Filter c_Filter = { FILTER_GROUP_ID | FILTER_PERMISSION, u32_EventGroupID, i_EventVer, true };
     
-    // Next, filter on event version if needed
+    // Filter on event version if needed
     if (i_EventVer < i_EventVerMax)
     {
-        FilterEventsVersion(v_Event, i_EventVer);
+        c_Filter.u32_Stage |= FILTER_VERSION;
     }
     
-    // Now filter based on reset state
-    switch (e_ResetState)
+    // Check for the event request and remove all events before it
+    if (e_ResetState == REQUIRE_REQUEST)
     {
-        case REQUIRE_REQUEST:
-            // Check for the event request and remove all events before it
-            if (FilterEventsResetRequest(v_Event) == true)
-            {
-                Logger::Singleton().Log(Logger::INFO, "User process sent a service reset request.",
-                                        "UserProcess.cpp", __LINE__);
-                e_ResetState = SEND_RESPONSE;
-            }
-            break;
-            
-        default:
-            // Filter based on app permissions and password
-            FilterEventsPermission(v_Event, true);
-            break;
+        c_Filter.u32_Stage |= FILTER_RESET_REQUEST;
+    }
+    
+    // Run all filters in a single pass
+    if (FilterEvents(v_Event, c_Filter) == true)
+    {
+        Logger::Singleton().Log(Logger::INFO, "User process sent a service reset request.",
+                                "UserProcess.cpp", __LINE__);
+        e_ResetState = SEND_RESPONSE;
     }
     
     return v_Event;
@@ -308,22 +311,21 @@ std::vector<Event>& UserProcess::RetrieveEvents() noexcept
 // Send
 //*************************************************************************************
 
-#if MRH_CORE_EVENT_LOGGING > 0
 void UserProcess::LogSentEvents(Event const& c_Event) noexcept
 {
-    EventLogger::Singleton().Log(c_Event, "Sending event to user process: " + s_PackagePath);
+    EventLogger::Singleton().Log(c_Event, EventLogFormat::SENT, EventLogFormat::USER, GetProcessID());
 }
-#endif
 
 void UserProcess::AddSendEvents(std::vector<Event>& v_Event) noexcept
 {
-    // Filter events by group id first
-    FilterEventsGroupID(v_Event);
+    // Filter by group id, app permissions and password
+    // @NOTE: We don't add missing permission events here - some services always send without request
+    Filter c_Filter = { FILTER_GROUP_ID | FILTER_PERMISSION, u32_EventGroupID, i_EventVer, false };
     
-    // Next, filter on event version if needed
+    // Filter on event version if needed
     if (i_EventVer < i_EventVerMax)
     {
-        FilterEventsVersion(v_Event, i_EventVer);
+        c_Filter.u32_Stage |= FILTER_VERSION;
     }
     
     // Now filter based on reset state
@@ -342,15 +344,14 @@ void UserProcess::AddSendEvents(std::vector<Event>& v_Event) noexcept
             Logger::Singleton().Log(Logger::INFO, "Sending reset request acknoledged response to user process.",
                                     "UserProcess.cpp", __LINE__);
         case RESET_COMPLETE:
-            // Check app permissions and password, filter events
-            // @NOTE: We don't add missing permission events here - some services always send without request
-            FilterEventsPermission(v_Event, false);
+            // Run all filters in a single pass
+            FilterEvents(v_Event, c_Filter);
             
-            // We now add all no permission events in front of the other events
+            // We now add all no permission events, the control lane sends them first
             if (v_PermissionDenied.size() > 0)
             {
                 v_Event.reserve(v_Event.size() + v_PermissionDenied.size());
-                v_Event.insert(v_Event.begin(), v_PermissionDenied.begin(), v_PermissionDenied.end());
+                v_Event.insert(v_Event.end(), v_PermissionDenied.begin(), v_PermissionDenied.end());
                 v_PermissionDenied.clear();
             }
             break;
@@ -367,10 +368,50 @@ void UserProcess::AddSendEvents(std::vector<Event>& v_Event) noexcept
 void UserProcess::SendEvents() noexcept
 {
     EventQueue::SendEvents(u32_EventLimit);
+    c_Throttle.Update(EventQueue::GetSendQueueDepth());
+    
+    if (EventQueue::GetFailed() == true)
+    {
+        Stop(true);
+    }
 }
 
 void UserProcess::SendEvents(std::vector<Event>& v_Event) noexcept
 {
     AddSendEvents(v_Event);
     EventQueue::SendEvents(v_Event, u32_EventLimit);
+    c_Throttle.Update(EventQueue::GetSendQueueDepth());
+    
+    if (EventQueue::GetFailed() == true)
+    {
+        Stop(true);
+    }
+}
+
+int UserProcess::GetSendPollFD() const noexcept
+{
+    if (EventQueue::GetSendQueueDepth() == 0)
+    {
+        return -1;
+    }
+    
+    return EventQueue::GetSendPollFD();
+}
+
+//*************************************************************************************
+// Statistics
+//*************************************************************************************
+
+void UserProcess::LogStatistics() noexcept
+{
+    EventQueue::LogStatistics("user process");
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+PoolThrottle& UserProcess::GetThrottle() noexcept
+{
+    return c_Throttle;
 }
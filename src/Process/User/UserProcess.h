@@ -25,6 +25,7 @@
 // Project
 #include "../Process.h"
 #include "./UserPermission.h"
+#include "../ServicePool/PoolThrottle.h"
 #include "../../Event/EventQueue.h"
 #include "../../Package/Package.h"
 
@@ -86,16 +87,41 @@ public:
      *  \param c_Event The event to log.
      */
         
-#if MRH_CORE_EVENT_LOGGING > 0
     void LogRecievedEvents(Event const& c_Event) noexcept override;
-#endif
     
     /**
-     *  Recieve events. The events are read from C_W_P_R.
+     *  Recieve events. The events are read from C_W_P_R. The recieve timeout
+     *  is only used if the source provides no recieve poll file descriptor.
      */
 
     void RecieveEvents() noexcept;
     
+    /**
+     *  Prepare the user process source for an external wait on the recieve
+     *  poll file descriptor.
+     *
+     *  \return true if the source can be waited on, false if events are already readable.
+     */
+    
+    bool PrepareRecievePoll() noexcept;
+    
+    /**
+     *  Get the file descriptor which becomes readable once user process
+     *  events can be recieved.
+     *
+     *  \return The file descriptor on success, -1 if not available.
+     */
+    
+    int GetRecievePollFD() const noexcept;
+    
+    /**
+     *  Check if recieving is throttled by the platform service consumers.
+     *
+     *  \return true if no events should be recieved, false if not.
+     */
+    
+    bool GetRecieveThrottled() const noexcept;
+    
     /**
      *  Retrieve recieved events.
      *
@@ -114,9 +140,7 @@ public:
      *  \param c_Event The event to log.
      */
         
-#if MRH_CORE_EVENT_LOGGING > 0
     void LogSentEvents(Event const& c_Event) noexcept override;
-#endif
     
     /**
      *  Add new events to send.
@@ -140,29 +164,39 @@ public:
 
     void SendEvents(std::vector<Event>& v_Event) noexcept;
     
-private:
-
+    /**
+     *  Get the file descriptor which becomes writable once remaining
+     *  events can be sent to the user process.
+     *
+     *  \return The file descriptor if events remain, -1 if not.
+     */
+    
+    int GetSendPollFD() const noexcept;
+    
     //*************************************************************************************
-    // Process Event Filter
+    // Statistics
     //*************************************************************************************
     
     /**
-     *  Filter events based on the current group id.
-     *
-     *  \param v_Event The event vector to check.
+     *  Log the user process event queue statistics.
      */
     
-    void FilterEventsGroupID(std::vector<Event>& v_Event) noexcept;
+    void LogStatistics() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
     
     /**
-     *  Filter events while looking for a reset request.
-     *
-     *  \param v_Event The event vector to check.
+     *  Get the user process throttle. The throttle tracks the user process as
+     *  consumer and limits the events recieved from it as producer.
      *
-     *  \return true if the reset request was found, false if not.
+     *  \return The user process throttle.
      */
     
-    bool FilterEventsResetRequest(std::vector<Event>& v_Event) noexcept;
+    PoolThrottle& GetThrottle() noexcept;
+    
+private:
 
     //*************************************************************************************
     // Getters
@@ -206,6 +240,9 @@ private:
     MRH_Uint32 u32_EventLimit;
     MRH_Sint32 s32_RecieveTimeoutMS;
     
+    // Backpressure
+    PoolThrottle c_Throttle;
+    
     // Event Version
     int i_EventVer;
     
@@ -213,9 +250,7 @@ private:
     ResetState e_ResetState;
     
     // Package
-#if MRH_CORE_EVENT_LOGGING > 0
     std::string s_PackagePath;
-#endif
 
 protected:
 
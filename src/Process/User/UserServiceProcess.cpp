@@ -35,22 +35,13 @@ namespace
 // Constructor / Destructor
 //*************************************************************************************
 
-#ifdef __MRH_MRHCKM_SUPPORTED__
-UserServiceProcess::UserServiceProcess() : ServiceProcess(TransmissionSource::SourceType::MRHCKM,
-                                                          false,
-                                                          true),
-                                           UserPermission(true)
-#else
-UserServiceProcess::UserServiceProcess() : ServiceProcess(TransmissionSource::SourceType::PIPE,
-                                                          false,
-                                                          true),
-                                           UserPermission(true)
-#endif
+UserServiceProcess::UserServiceProcess(TransmissionSource::SourceType e_Type) : ServiceProcess(e_Type,
+                                                                                               false,
+                                                                                               true),
+                                                                                UserPermission(true)
 {
     // Package
-#if MRH_CORE_EVENT_LOGGING > 0
     s_PackagePath = "<undefined>";
-#endif
     
     // Event version
     i_EventVer = -1;
@@ -80,6 +71,10 @@ void UserServiceProcess::Run(Package const& c_Package, std::string s_BinaryPath,
         throw ProcessException("Failed to reset event queue: " + e.what2()); // Convert to process exception
     }
     
+#if MRH_CORE_EVENT_TRACING > 0
+    EventQueue::SetTraceEndpoint(this->s_RunPath);
+#endif
+    
     // Basics reset, check package event ver for communication
     i_EventVer = c_Package.PackageService::GetServiceEventVersion();
     
@@ -110,13 +105,17 @@ void UserServiceProcess::Run(Package const& c_Package, std::string s_BinaryPath,
     try
     {
         v_Arg.emplace_back(GetArgumentBytes(this->s_RunPath));
-        v_Arg.emplace_back(GetArgumentBytes(std::to_string(GetPipeFD(QueueType::C_W_P_R, SourcePipe::PipeEnd::PIPE_END_WRITE))));
+        v_Arg.emplace_back(GetArgumentBytes(GetSourceArgument(QueueType::C_W_P_R)));
         v_Arg.emplace_back(GetArgumentBytes(std::to_string(u32_EventLimit)));
         
+        // Legacy parents ignore the trailing wire format offer
+        if (GetWireVersion() > 1)
+        {
+            v_Arg.emplace_back(GetArgumentBytes(std::to_string(GetWireVersion())));
+        }
+        
         // Update the package path after a successfull launch
-#if MRH_CORE_EVENT_LOGGING > 0
         s_PackagePath = c_Package.GetPackagePath();
-#endif
     }
     catch (ProcessException& e)
     {
@@ -136,32 +135,33 @@ void UserServiceProcess::Run(Package const& c_Package, std::string s_BinaryPath,
     {
         throw;
     }
+    
+    EventLogger::Singleton().LogProcess(EventLogFormat::USER_SERVICE, GetProcessID(), s_PackagePath);
 }
 
 //*************************************************************************************
 // Recieve
 //*************************************************************************************
 
-#if MRH_CORE_EVENT_LOGGING > 0
 void UserServiceProcess::LogRecievedEvents(Event const& c_Event) noexcept
 {
-    EventLogger::Singleton().Log(c_Event, "Recieved event from user service process: " + s_PackagePath);
+    EventLogger::Singleton().Log(c_Event, EventLogFormat::RECIEVED, EventLogFormat::USER_SERVICE, GetProcessID());
 }
-#endif
 
 std::vector<Event>& UserServiceProcess::RetrieveEvents() noexcept
 {
     // Filter events based on service permissions
     std::vector<Event>& v_Event = EventQueue::RetrieveEvents();
-    
-    // Run filters
-    FilterEventsPermission(v_Event, false); // No response for services
+    Filter c_Filter = { FILTER_PERMISSION, 0, i_EventVer, false }; // No response for services
     
     if (i_EventVer < i_EventVerMax)
     {
-        FilterEventsVersion(v_Event, i_EventVer);
+        c_Filter.u32_Stage |= FILTER_VERSION;
     }
     
+    // Run all filters in a single pass
+    FilterEvents(v_Event, c_Filter);
+    
     return v_Event;
 }
 
@@ -169,11 +169,7 @@ std::vector<Event>& UserServiceProcess::RetrieveEvents() noexcept
 // Send
 //*************************************************************************************
 
-#if MRH_CORE_EVENT_LOGGING > 0
 void UserServiceProcess::LogSentEvents(Event const& c_Event) noexcept
 {
-    EventLogger::Singleton().Log(c_Event, "Sending event to user service process: " +
-                                          s_PackagePath +
-                                          " (User servies are not allowed to have events sent to them!)");
+    EventLogger::Singleton().Log(c_Event, EventLogFormat::SENT, EventLogFormat::USER_SERVICE, GetProcessID());
 }
-#endif
@@ -37,9 +37,11 @@ public:
     
     /**
      *  Default constructor.
+     *
+     *  \param e_Type The transmission source type.
      */
     
-    UserServiceProcess();
+    UserServiceProcess(TransmissionSource::SourceType e_Type);
     
     /**
      *  Copy constructor. Disabled for this class.
@@ -79,9 +81,7 @@ public:
      *  \param c_Event The event to log.
      */
                 
-#if MRH_CORE_EVENT_LOGGING > 0
     void LogRecievedEvents(Event const& c_Event) noexcept override;
-#endif
     
     /**
      *  Retrieve recieved events.
@@ -101,9 +101,7 @@ public:
      *  \param c_Event The event to log.
      */
                 
-#if MRH_CORE_EVENT_LOGGING > 0
     void LogSentEvents(Event const& c_Event) noexcept override;
-#endif
     
 private:
 
@@ -112,9 +110,7 @@ private:
     //*************************************************************************************
 
     // Package
-#if MRH_CORE_EVENT_LOGGING > 0
     std::string s_PackagePath;
-#endif
     
     // Event Version
     int i_EventVer;
@@ -0,0 +1,413 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <unistd.h>
+#include <poll.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+
+// External
+
+// Project
+#include "../Event/EventQueue.h"
+#include "../Logger/Logger.h"
+
+// Pre-defined
+namespace
+{
+    // Batch header (v2) sent to accept batches: Magic, Count, Length, Sequence
+    // @NOTE: Matches the wire format written by EventQueue
+    constexpr MRH_Uint32 u32_BatchMagic = 0x3248524D; // "MRH2"
+    
+    // Events added to the send queue at once
+    constexpr size_t us_SendChunk = 64;
+    
+    // Benchmark event type, any type is transported the same way
+    constexpr MRH_Uint32 u32_EventType = 1;
+    
+    // Event queues are only used by processes, expose the queue directly
+    class BenchmarkQueue : public EventQueue
+    {
+    public:
+        BenchmarkQueue() : EventQueue(TransmissionSource::SourceType::PIPE)
+        {}
+        
+        using EventQueue::QueueType;
+        using EventQueue::Reset;
+        using EventQueue::SetTransport;
+        using EventQueue::SetWireVersion;
+        using EventQueue::RecieveEvents;
+        using EventQueue::RetrieveEvents;
+        using EventQueue::AddSendEvents;
+        using EventQueue::SendEvents;
+        using EventQueue::GetPipeFD;
+        using EventQueue::GetSendQueueDepth;
+        using EventQueue::GetFailed;
+        using EventQueue::GetSendPollFD;
+    };
+    
+    struct QueueOptions
+    {
+        size_t us_Events;
+        MRH_Uint32 u32_DataSize;
+        MRH_Uint32 u32_WireVersion;
+        size_t us_Capacity;
+    };
+    
+    struct LoggerOptions
+    {
+        size_t us_Messages;                      // Per thread
+        size_t us_Threads;
+    };
+}
+
+
+//*************************************************************************************
+// Time
+//*************************************************************************************
+
+static MRH_Uint64 GetTimeNS() noexcept
+{
+    return static_cast<MRH_Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+//*************************************************************************************
+// Queue
+//*************************************************************************************
+
+static bool AcceptBatches(BenchmarkQueue& c_Queue)
+{
+    // The send side only batches once the peer sent a batch itself
+    MRH_Uint8 p_Batch[sizeof(MRH_Uint32) * 4 + 6] = { 0 };
+    MRH_Uint32 p_Header[4] = { u32_BatchMagic, 1, 6, 0 };
+    
+    std::memcpy(p_Batch, p_Header, sizeof(p_Header));
+    p_Batch[sizeof(p_Header) + sizeof(MRH_Uint32)] = static_cast<MRH_Uint8>(u32_EventType);
+    
+    if (write(c_Queue.GetPipeFD(BenchmarkQueue::C_W_P_R, SourcePipe::PIPE_END_WRITE), p_Batch, sizeof(p_Batch)) != sizeof(p_Batch))
+    {
+        return false;
+    }
+    
+    c_Queue.RecieveEvents(1, 1000);
+    
+    if (c_Queue.RetrieveEvents().size() != 1)
+    {
+        return false;
+    }
+    
+    // Applied on the next recieve
+    c_Queue.RecieveEvents(1, 0);
+    return true;
+}
+
+static void SendEvents(BenchmarkQueue* p_Queue, QueueOptions const* p_Options)
+{
+    std::vector<MRH_Uint8> v_Data(p_Options->u32_DataSize, 0);
+    std::vector<Event> v_Event;
+    struct pollfd c_PollFD;
+    MRH_Uint64 u64_TimeNS;
+    
+    c_PollFD.fd = p_Queue->GetSendPollFD();
+    c_PollFD.events = POLLOUT;
+    
+    for (size_t us_Sent = 0; us_Sent < p_Options->us_Events;)
+    {
+        size_t us_Chunk = std::min(us_SendChunk, p_Options->us_Events - us_Sent);
+        
+        // The creation time travels with the event for the latency
+        for (size_t i = 0; i < us_Chunk; ++i)
+        {
+            u64_TimeNS = GetTimeNS();
+            std::memcpy(v_Data.data(), &u64_TimeNS, sizeof(u64_TimeNS));
+            v_Event.emplace_back(0, u32_EventType, v_Data.data(), v_Data.size());
+        }
+        
+        p_Queue->AddSendEvents(v_Event);
+        us_Sent += us_Chunk;
+        
+        while (p_Queue->GetSendQueueDepth() > 0)
+        {
+            p_Queue->SendEvents(us_SendChunk);
+            
+            if (p_Queue->GetSendQueueDepth() > 0)
+            {
+                poll(&c_PollFD, 1, 100);
+            }
+        }
+    }
+}
+
+static int RunQueue(QueueOptions const& c_Options)
+{
+    // Sender writes P_W_C_R, the reciever reads it as C_W_P_R
+    BenchmarkQueue c_Sender;
+    BenchmarkQueue c_Reciever;
+    
+    try
+    {
+        c_Sender.SetTransport(c_Options.us_Capacity, 0, 0);
+        c_Sender.SetWireVersion(c_Options.u32_WireVersion);
+        c_Reciever.SetTransport(c_Options.us_Capacity, 0, 0);
+        c_Reciever.SetWireVersion(c_Options.u32_WireVersion);
+        
+        c_Sender.Reset();
+        c_Reciever.Reset();
+        
+        if (dup2(c_Sender.GetPipeFD(BenchmarkQueue::P_W_C_R, SourcePipe::PIPE_END_READ),
+                 c_Reciever.GetPipeFD(BenchmarkQueue::C_W_P_R, SourcePipe::PIPE_END_READ)) < 0)
+        {
+            std::cerr << "Failed to connect event queues!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        
+        if (c_Options.u32_WireVersion > 1 && AcceptBatches(c_Sender) == false)
+        {
+            std::cerr << "Failed to enable event batches!" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    catch (EventException& e)
+    {
+        std::cerr << "Failed to setup event queues: " << e.what2() << std::endl;
+        return EXIT_FAILURE;
+    }
+    
+    std::vector<MRH_Uint64> v_LatencyNS;
+    v_LatencyNS.reserve(c_Options.us_Events);
+    
+    MRH_Uint64 u64_StartNS = GetTimeNS();
+    std::thread c_Thread(SendEvents, &c_Sender, &c_Options);
+    MRH_Uint64 u64_SentNS;
+    
+    while (v_LatencyNS.size() < c_Options.us_Events)
+    {
+        c_Reciever.RecieveEvents(us_SendChunk * 4, 1000);
+        
+        for (auto& Recieved : c_Reciever.RetrieveEvents())
+        {
+            std::memcpy(&u64_SentNS, Recieved.GetData(), sizeof(u64_SentNS));
+            v_LatencyNS.emplace_back(GetTimeNS() - u64_SentNS);
+        }
+        
+        if (c_Reciever.GetFailed() == true)
+        {
+            break;
+        }
+    }
+    
+    MRH_Uint64 u64_TotalNS = GetTimeNS() - u64_StartNS;
+    c_Thread.join();
+    
+    if (v_LatencyNS.size() < c_Options.us_Events)
+    {
+        std::cerr << "Recieved " << v_LatencyNS.size() << " of " << c_Options.us_Events << " events!" << std::endl;
+        return EXIT_FAILURE;
+    }
+    
+    std::sort(v_LatencyNS.begin(), v_LatencyNS.end());
+    
+    double f64_Seconds = static_cast<double>(u64_TotalNS) / 1e9;
+    double f64_Events = static_cast<double>(v_LatencyNS.size());
+    MRH_Uint64 u64_SumNS = 0;
+    
+    for (auto LatencyNS : v_LatencyNS)
+    {
+        u64_SumNS += LatencyNS;
+    }
+    
+    std::printf("Events: %zu, Data: %u bytes, Wire: v%u, Pipe capacity: %zu\n",
+                v_LatencyNS.size(),
+                c_Options.u32_DataSize,
+                c_Options.u32_WireVersion,
+                c_Options.us_Capacity);
+    std::printf("Throughput: %.0f events/s, %.2f MiB/s\n",
+                f64_Events / f64_Seconds,
+                (f64_Events * c_Options.u32_DataSize) / f64_Seconds / (1024 * 1024));
+    std::printf("Latency (us): avg %.1f, p50 %.1f, p99 %.1f, max %.1f\n",
+                (static_cast<double>(u64_SumNS) / f64_Events) / 1000,
+                static_cast<double>(v_LatencyNS[v_LatencyNS.size() / 2]) / 1000,
+                static_cast<double>(v_LatencyNS[(v_LatencyNS.size() * 99) / 100]) / 1000,
+                static_cast<double>(v_LatencyNS.back()) / 1000);
+    
+    return EXIT_SUCCESS;
+}
+
+//*************************************************************************************
+// Logger
+//*************************************************************************************
+
+static void LogMessages(size_t us_Messages, MRH_Uint64* p_TimeNS)
+{
+    Logger& c_Logger = Logger::Singleton();
+    MRH_Uint64 u64_StartNS = GetTimeNS();
+    
+    // Messages are formatted by the caller, like every log site
+    for (size_t i = 0; i < us_Messages; ++i)
+    {
+        c_Logger.Log(Logger::INFO, "Benchmark message " + std::to_string(i), "Benchmark.cpp", __LINE__);
+    }
+    
+    *p_TimeNS = GetTimeNS() - u64_StartNS;
+}
+
+static int RunLogger(LoggerOptions const& c_Options)
+{
+    std::vector<std::thread> v_Thread;
+    std::vector<MRH_Uint64> v_TimeNS(c_Options.us_Threads, 0);
+    
+    // Create the logger and its writer first
+    Logger::Singleton();
+    
+    MRH_Uint64 u64_StartNS = GetTimeNS();
+    
+    for (size_t i = 0; i < c_Options.us_Threads; ++i)
+    {
+        v_Thread.emplace_back(LogMessages, c_Options.us_Messages, &(v_TimeNS[i]));
+    }
+    
+    for (auto& Thread : v_Thread)
+    {
+        Thread.join();
+    }
+    
+    MRH_Uint64 u64_TotalNS = GetTimeNS() - u64_StartNS;
+    MRH_Uint64 u64_CallNS = 0;
+    double f64_Messages = static_cast<double>(c_Options.us_Messages * c_Options.us_Threads);
+    
+    for (auto TimeNS : v_TimeNS)
+    {
+        u64_CallNS += TimeNS;
+    }
+    
+    std::printf("Messages: %zu, Threads: %zu\n",
+                c_Options.us_Messages * c_Options.us_Threads,
+                c_Options.us_Threads);
+    std::printf("Log call: %.1f ns/message\n",
+                static_cast<double>(u64_CallNS) / f64_Messages);
+    std::printf("Throughput: %.0f messages/s\n",
+                f64_Messages / (static_cast<double>(u64_TotalNS) / 1e9));
+    
+    return EXIT_SUCCESS;
+}
+
+//*************************************************************************************
+// Main
+//*************************************************************************************
+
+static void PrintUsage() noexcept
+{
+    std::cerr << "Usage: mrhcore-benchmark queue [--events <count>] [--size <bytes>] [--wire <version>] [--capacity <bytes>]" << std::endl;
+    std::cerr << "       mrhcore-benchmark logger [--messages <count>] [--threads <count>]" << std::endl;
+}
+
+static bool GetQueueOptions(int argc, const char* argv[], QueueOptions& c_Options) noexcept
+{
+    c_Options.us_Events = 1000000;
+    c_Options.u32_DataSize = 64;
+    c_Options.u32_WireVersion = 1;
+    c_Options.us_Capacity = 0; // System default
+    
+    for (int i = 2; i < argc; ++i)
+    {
+        if (i + 1 == argc)
+        {
+            return false;
+        }
+        else if (std::strcmp(argv[i], "--events") == 0)
+        {
+            c_Options.us_Events = std::strtoull(argv[++i], NULL, 10);
+        }
+        else if (std::strcmp(argv[i], "--size") == 0)
+        {
+            c_Options.u32_DataSize = static_cast<MRH_Uint32>(std::strtoul(argv[++i], NULL, 10));
+        }
+        else if (std::strcmp(argv[i], "--wire") == 0)
+        {
+            c_Options.u32_WireVersion = static_cast<MRH_Uint32>(std::strtoul(argv[++i], NULL, 10));
+        }
+        else if (std::strcmp(argv[i], "--capacity") == 0)
+        {
+            c_Options.us_Capacity = std::strtoull(argv[++i], NULL, 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    
+    // Event data holds the creation time
+    if (c_Options.u32_DataSize < sizeof(MRH_Uint64))
+    {
+        c_Options.u32_DataSize = sizeof(MRH_Uint64);
+    }
+    
+    return c_Options.us_Events > 0 && c_Options.u32_WireVersion >= 1 && c_Options.u32_WireVersion <= 2;
+}
+
+static bool GetLoggerOptions(int argc, const char* argv[], LoggerOptions& c_Options) noexcept
+{
+    c_Options.us_Messages = 1000000;
+    c_Options.us_Threads = 1;
+    
+    for (int i = 2; i < argc; ++i)
+    {
+        if (i + 1 == argc)
+        {
+            return false;
+        }
+        else if (std::strcmp(argv[i], "--messages") == 0)
+        {
+            c_Options.us_Messages = std::strtoull(argv[++i], NULL, 10);
+        }
+        else if (std::strcmp(argv[i], "--threads") == 0)
+        {
+            c_Options.us_Threads = std::strtoull(argv[++i], NULL, 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    
+    return c_Options.us_Messages > 0 && c_Options.us_Threads > 0;
+}
+
+int main(int argc, const char* argv[])
+{
+    QueueOptions c_QueueOptions;
+    LoggerOptions c_LoggerOptions;
+    
+    if (argc >= 2 && std::strcmp(argv[1], "queue") == 0 && GetQueueOptions(argc, argv, c_QueueOptions) == true)
+    {
+        return RunQueue(c_QueueOptions);
+    }
+    else if (argc >= 2 && std::strcmp(argv[1], "logger") == 0 && GetLoggerOptions(argc, argv, c_LoggerOptions) == true)
+    {
+        return RunLogger(c_LoggerOptions);
+    }
+    
+    PrintUsage();
+    return EXIT_FAILURE;
+}
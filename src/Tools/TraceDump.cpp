@@ -0,0 +1,306 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <ctime>
+
+// External
+
+// Project
+#include "../Logger/EventLogFormat.h"
+#include "../Event/EventMeta.h"
+
+// Pre-defined
+namespace
+{
+    // Bytes per hex data line
+    constexpr MRH_Uint32 u32_LineBytes = 32;
+    
+    // Process name lookup, by source and process id
+    typedef std::map<std::pair<MRH_Uint8, MRH_Uint32>, std::string> ProcessNames;
+}
+
+
+//*************************************************************************************
+// Format
+//*************************************************************************************
+
+static std::string GetProcessName(ProcessNames const& m_Name, EventLogFormat::RecordHeader const& c_Header) noexcept
+{
+    auto Name = m_Name.find(std::make_pair(c_Header.u8_Source, c_Header.u32_ProcessID));
+    
+    if (Name == m_Name.end())
+    {
+        return "<undefined>";
+    }
+    
+    return Name->second;
+}
+
+static std::string GetLogMessage(ProcessNames const& m_Name, EventLogFormat::RecordHeader const& c_Header) noexcept
+{
+    bool b_Recieved = (c_Header.u8_Direction == EventLogFormat::RECIEVED);
+    
+    switch (c_Header.u8_Source)
+    {
+        case EventLogFormat::USER:
+            return (b_Recieved ? "Recieved event from user process: " : "Sending event to user process: ") + GetProcessName(m_Name, c_Header);
+        case EventLogFormat::USER_SERVICE:
+            if (b_Recieved == true)
+            {
+                return "Recieved event from user service process: " + GetProcessName(m_Name, c_Header);
+            }
+            return "Sending event to user service process: " + GetProcessName(m_Name, c_Header) + " (User servies are not allowed to have events sent to them!)";
+        case EventLogFormat::PLATFORM_SERVICE:
+            return (b_Recieved ? "Recieved event from platform service process: " : "Sending event to platform service process: ") + GetProcessName(m_Name, c_Header);
+        case EventLogFormat::QUEUE:
+            return (b_Recieved ? "Default event queue recieved logger." : "Default event queue sent logger.");
+        
+        default:
+            return "<Unknown event source " + std::to_string(c_Header.u8_Source) + ">";
+    }
+}
+
+static std::string GetHex(const MRH_Uint8* p_Data, MRH_Uint32 u32_Bytes, const char* p_Format) noexcept
+{
+    std::string s_Hex;
+    char p_Hex[8];
+    
+    for (MRH_Uint32 i = 0; i < u32_Bytes; ++i)
+    {
+        snprintf(p_Hex, sizeof(p_Hex), p_Format, p_Data[i]);
+        s_Hex += p_Hex;
+    }
+    
+    return s_Hex;
+}
+
+static std::string GetCSVField(std::string const& s_Field) noexcept
+{
+    std::string s_Result = "\"";
+    
+    for (auto Char : s_Field)
+    {
+        if (Char == '"')
+        {
+            s_Result += '"';
+        }
+        
+        s_Result += Char;
+    }
+    
+    return s_Result + "\"";
+}
+
+//*************************************************************************************
+// Print
+//*************************************************************************************
+
+static void PrintText(ProcessNames const& m_Name, EventLogFormat::RecordHeader const& c_Header, const MRH_Uint8* p_Payload) noexcept
+{
+    time_t s_RawTime = static_cast<time_t>(c_Header.u64_TimeNS / (1000 * 1000 * 1000));
+    std::string s_Time(std::ctime(&s_RawTime));
+    s_Time.erase(s_Time.end() - 1); // ctime adds a newline, why?
+    
+    std::cout << "===" << "\n"
+              << "- " << c_Header.u64_Sequence << ": " << EventMeta::Get(c_Header.u32_Type).p_Name << " (" << c_Header.u32_Type << ") -" << "\n"
+              << "Time: " << s_Time << "\n"
+              << "Log Message: " << GetLogMessage(m_Name, c_Header) << "\n"
+              << "Event Group ID: " << c_Header.u32_GroupID << "\n"
+              << "Event Data Size: " << c_Header.u32_DataSize << "\n"
+              << "Event Data:" << "\n";
+    
+    if (c_Header.u32_PayloadSize > 0)
+    {
+        for (MRH_Uint32 u32_Pos = 0; u32_Pos < c_Header.u32_PayloadSize; u32_Pos += u32_LineBytes)
+        {
+            MRH_Uint32 u32_Bytes = c_Header.u32_PayloadSize - u32_Pos;
+            
+            std::cout << GetHex(&(p_Payload[u32_Pos]), (u32_Bytes > u32_LineBytes ? u32_LineBytes : u32_Bytes), "0x%02X ") << "\n";
+        }
+        
+        if (c_Header.u32_PayloadSize < c_Header.u32_DataSize)
+        {
+            std::cout << "<Event data truncated, " << (c_Header.u32_DataSize - c_Header.u32_PayloadSize) << " bytes not logged>" << "\n";
+        }
+    }
+    else
+    {
+        std::cout << "<No event data available>" << "\n";
+    }
+    
+    std::cout << "===" << "\n";
+}
+
+static void PrintCSV(ProcessNames const& m_Name, EventLogFormat::RecordHeader const& c_Header, const MRH_Uint8* p_Payload) noexcept
+{
+    static const char* p_Direction[EventLogFormat::DIRECTION_COUNT] =
+    {
+        "recieved",
+        "sent"
+    };
+    static const char* p_Source[EventLogFormat::SOURCE_COUNT] =
+    {
+        "user",
+        "user_service",
+        "platform_service",
+        "queue"
+    };
+    
+    std::cout << c_Header.u64_Sequence << ","
+              << c_Header.u64_TimeNS << ","
+              << (c_Header.u8_Direction < EventLogFormat::DIRECTION_COUNT ? p_Direction[c_Header.u8_Direction] : "") << ","
+              << (c_Header.u8_Source < EventLogFormat::SOURCE_COUNT ? p_Source[c_Header.u8_Source] : "") << ","
+              << c_Header.u32_ProcessID << ","
+              << GetCSVField(c_Header.u8_Source == EventLogFormat::QUEUE ? "" : GetProcessName(m_Name, c_Header)) << ","
+              << c_Header.u32_GroupID << ","
+              << c_Header.u32_Type << ","
+              << EventMeta::Get(c_Header.u32_Type).p_Name << ","
+              << c_Header.u32_DataSize << ","
+              << c_Header.u32_PayloadSize << ","
+              << GetHex(p_Payload, c_Header.u32_PayloadSize, "%02X") << "\n";
+}
+
+//*************************************************************************************
+// Main
+//*************************************************************************************
+
+int main(int argc, const char* argv[])
+{
+    bool b_CSV = false;
+    const char* p_FilePath = NULL;
+    
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--csv") == 0)
+        {
+            b_CSV = true;
+        }
+        else
+        {
+            p_FilePath = argv[i];
+        }
+    }
+    
+    if (p_FilePath == NULL)
+    {
+        std::cerr << "Usage: mrhcore-tracedump [--csv] <file>" << std::endl;
+        return EXIT_FAILURE;
+    }
+    
+    std::ifstream f_File(p_FilePath, std::ios::in | std::ios::binary);
+    
+    if (f_File.is_open() == false)
+    {
+        std::cerr << "Failed to open event log file: " << p_FilePath << std::endl;
+        return EXIT_FAILURE;
+    }
+    
+    EventLogFormat::FileHeader c_FileHeader;
+    
+    if (f_File.read(reinterpret_cast<char*>(&c_FileHeader), sizeof(c_FileHeader)).good() == false ||
+        c_FileHeader.u64_Magic != EventLogFormat::u64_Magic)
+    {
+        std::cerr << "Not a binary event log file: " << p_FilePath << std::endl;
+        return EXIT_FAILURE;
+    }
+    else if (c_FileHeader.u32_Version != EventLogFormat::u32_Version)
+    {
+        std::cerr << "Unsupported event log version: " << c_FileHeader.u32_Version << std::endl;
+        return EXIT_FAILURE;
+    }
+    else if (c_FileHeader.u32_PayloadLimit > EventLogFormat::u32_PayloadLimitMax)
+    {
+        std::cerr << "Malformed event log file header: Payload limit " << c_FileHeader.u32_PayloadLimit << " too large!" << std::endl;
+        return EXIT_FAILURE;
+    }
+    
+    if (b_CSV == true)
+    {
+        std::cout << "sequence,time_ns,direction,source,process_id,process,group_id,type,name,data_size,payload_size,payload" << "\n";
+    }
+    
+    ProcessNames m_Name;
+    EventLogFormat::RecordHeader c_Header;
+    std::vector<MRH_Uint8> v_Payload;
+    MRH_Uint32 u32_PayloadLimit;
+    
+    while (f_File.read(reinterpret_cast<char*>(&c_Header), sizeof(c_Header)).good() == true)
+    {
+        // Bound the payload first, the record size wraps for huge payloads
+        switch (c_Header.u16_RecordType)
+        {
+            case EventLogFormat::RECORD_EVENT:
+                u32_PayloadLimit = c_FileHeader.u32_PayloadLimit;
+                break;
+            case EventLogFormat::RECORD_PROCESS:
+                u32_PayloadLimit = EventLogFormat::u32_NameLimit;
+                break;
+            
+            default:
+                u32_PayloadLimit = 0;
+                break;
+        }
+        
+        if (c_Header.u16_RecordType > EventLogFormat::RECORD_TYPE_MAX ||
+            c_Header.u32_PayloadSize > u32_PayloadLimit ||
+            c_Header.u32_PayloadSize > c_Header.u32_DataSize ||
+            c_Header.u32_RecordSize < sizeof(c_Header) ||
+            c_Header.u32_RecordSize != EventLogFormat::GetRecordSize(c_Header.u32_PayloadSize))
+        {
+            std::cout << std::flush;
+            std::cerr << "Malformed event log file: Broken record after sequence " << c_Header.u64_Sequence << "!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        
+        v_Payload.resize(c_Header.u32_RecordSize - sizeof(c_Header));
+        
+        if (v_Payload.size() > 0 && f_File.read(reinterpret_cast<char*>(v_Payload.data()), v_Payload.size()).good() == false)
+        {
+            std::cerr << "Truncated record " << c_Header.u64_Sequence << " at end of file, stopping." << std::endl;
+            break;
+        }
+        
+        if (c_Header.u16_RecordType == EventLogFormat::RECORD_PROCESS)
+        {
+            m_Name[std::make_pair(c_Header.u8_Source, c_Header.u32_ProcessID)] = std::string(reinterpret_cast<const char*>(v_Payload.data()),
+                                                                                           c_Header.u32_PayloadSize);
+        }
+        else if (c_Header.u16_RecordType == EventLogFormat::RECORD_EVENT)
+        {
+            if (b_CSV == true)
+            {
+                PrintCSV(m_Name, c_Header, v_Payload.data());
+            }
+            else
+            {
+                PrintText(m_Name, c_Header, v_Payload.data());
+            }
+        }
+    }
+    
+    std::cout << std::flush;
+    
+    return EXIT_SUCCESS;
+}